@@ -88,6 +88,9 @@ void CommandLineParser::init()
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
     m_parser.addOption(QCommandLineOption("extension", "Use extension to process a conversion job", "uri"));
+    m_parser.addOption(QCommandLineOption("batch-workers",
+                                          "Use with '-j <file>', distribute the conversion jobs over the given number of worker processes",
+                                          "count"));
 
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -100,6 +103,9 @@ void CommandLineParser::init()
                                           "Export all media (excepting mp3) for a given score in a single JSON file and print it to stdout"));
     m_parser.addOption(QCommandLineOption("highlight-config", "Set highlight to svg, generated from a given score", "highlight-config"));
     m_parser.addOption(QCommandLineOption("score-meta", "Export score metadata to JSON document and print it to stdout"));
+    m_parser.addOption(QCommandLineOption("score-meta-layout",
+                                          "Use with '--score-meta', lay out the score to also export layout-dependent metadata, "
+                                          "such as the page count"));
     m_parser.addOption(QCommandLineOption("score-parts", "Generate parts data for the given score and save them to separate mscz files"));
     m_parser.addOption(QCommandLineOption("score-parts-pdf",
                                           "Generate parts data for the given score and export the data to a single JSON file, print it to stdout"));
@@ -318,6 +324,13 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options.runMode = IApplication::RunMode::ConsoleApp;
         m_options.converterTask.type = ConvertType::Batch;
         m_options.converterTask.inputFile = fromUserInputPath(m_parser.value("j"));
+
+        if (m_parser.isSet("batch-workers")) {
+            std::optional<int> workers = intValue("batch-workers");
+            if (workers && workers.value() > 1) {
+                m_options.converterTask.params[CmdOptions::ParamKey::BatchWorkers] = workers.value();
+            }
+        }
     }
 
     if (m_parser.isSet("score-media")) {
@@ -334,6 +347,9 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options.runMode = IApplication::RunMode::ConsoleApp;
         m_options.converterTask.type = ConvertType::ExportScoreMeta;
         m_options.converterTask.inputFile = scorefiles[0];
+        if (m_parser.isSet("score-meta-layout")) {
+            m_options.converterTask.params[CmdOptions::ParamKey::ScoreMetaWithLayout] = true;
+        }
     }
 
     if (m_parser.isSet("score-parts")) {
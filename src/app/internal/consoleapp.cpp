@@ -32,6 +32,8 @@
 #include "muse_framework_config.h"
 #include "app_config.h"
 
+#include "engraving/dom/mscore.h"
+
 #include "log.h"
 
 using namespace muse;
@@ -231,6 +233,9 @@ void ConsoleApp::applyCommandLineOptions(const CmdOptions& options, IApplication
         for (project::MigrationType type : project::allMigrationTypes()) {
             projectConfiguration()->setMigrationOptions(type, migration, false);
         }
+
+        //! NOTE Nothing else competes for the cores while converting
+        mu::engraving::MScore::parallelLayout = true;
     }
 
 #ifdef MUE_BUILD_IMPEXP_IMAGESEXPORT_MODULE
@@ -282,9 +287,10 @@ int ConsoleApp::processConverter(const CmdOptions::ConverterTask& task)
     }
 
     switch (task.type) {
-    case ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, soundProfile, extensionUri);
-        break;
+    case ConvertType::Batch: {
+        size_t workers = task.params.value(CmdOptions::ParamKey::BatchWorkers, 1).toUInt();
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, soundProfile, extensionUri, nullptr, workers);
+    } break;
     case ConvertType::File: {
         std::string transposeOptionsJson = task.params[CmdOptions::ParamKey::ScoreTransposeOptions].toString().toStdString();
         ret = converter()->fileConvert(task.inputFile, task.outputFile, stylePath, forceMode, soundProfile, extensionUri,
@@ -297,9 +303,10 @@ int ConsoleApp::processConverter(const CmdOptions::ConverterTask& task)
         muse::io::path_t highlightConfigPath = task.params[CmdOptions::ParamKey::HighlightConfigPath].toString();
         ret = converter()->exportScoreMedia(task.inputFile, task.outputFile, highlightConfigPath, stylePath, forceMode);
     } break;
-    case ConvertType::ExportScoreMeta:
-        ret = converter()->exportScoreMeta(task.inputFile, task.outputFile, stylePath, forceMode);
-        break;
+    case ConvertType::ExportScoreMeta: {
+        bool withLayoutData = task.params[CmdOptions::ParamKey::ScoreMetaWithLayout].toBool();
+        ret = converter()->exportScoreMeta(task.inputFile, task.outputFile, stylePath, forceMode, withLayoutData);
+    } break;
     case ConvertType::ExportScoreParts:
         ret = converter()->exportScoreParts(task.inputFile, task.outputFile, stylePath, forceMode);
         break;
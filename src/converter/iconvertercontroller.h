@@ -42,7 +42,8 @@ public:
     virtual muse::Ret batchConvert(const muse::io::path_t& batchJobFile,
                                    const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false,
                                    const muse::String& soundProfile = muse::String(),
-                                   const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr) = 0;
+                                   const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr,
+                                   size_t workers = 1) = 0;
 
     virtual muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out,
                                         const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) = 0;
@@ -51,7 +52,8 @@ public:
                                        const muse::io::path_t& highlightConfigPath = muse::io::path_t(),
                                        const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) = 0;
     virtual muse::Ret exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out,
-                                      const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) = 0;
+                                      const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false,
+                                      bool withLayoutData = false) = 0;
     virtual muse::Ret exportScoreParts(const muse::io::path_t& in, const muse::io::path_t& out,
                                        const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) = 0;
     virtual muse::Ret exportScorePartsPdfs(const muse::io::path_t& in, const muse::io::path_t& out,
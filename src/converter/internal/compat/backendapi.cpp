@@ -31,8 +31,12 @@
 #include <QRandomGenerator>
 
 #include "io/buffer.h"
+#include "io/file.h"
 
 #include "engraving/infrastructure/mscwriter.h"
+#include "engraving/infrastructure/mscreader.h"
+#include "engraving/infrastructure/localfileinfoprovider.h"
+#include "engraving/dom/masterscore.h"
 #include "engraving/dom/excerpt.h"
 #include "engraving/rw/mscsaver.h"
 
@@ -102,25 +106,51 @@ Ret BackendApi::exportScoreMedia(const muse::io::path_t& in, const muse::io::pat
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
-Ret BackendApi::exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath, bool forceMode)
+Ret BackendApi::exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath, bool forceMode,
+                                bool withLayoutData)
 {
     TRACEFUNC
 
-    RetVal<INotationProjectPtr> prj = openProject(in, stylePath, forceMode);
+    //! NOTE Most of the meta data comes straight from the score model,
+    //! so skip the layout unless the caller asked for layout-dependent fields.
+    //! Imported formats go through the regular path, since their readers lay out the score anyway.
+    if (withLayoutData || !isMuseScoreFile(io::suffix(in))) {
+        RetVal<INotationProjectPtr> prj = openProject(in, stylePath, forceMode);
+        if (!prj.ret) {
+            return prj.ret;
+        }
+
+        INotationPtr notation = prj.val->masterNotation()->notation();
+
+        QFile outputFile;
+        openOutputFile(outputFile, out);
+
+        BackendJsonWriter jsonWriter(&outputFile);
+
+        bool result = exportScoreMetaData(notation, jsonWriter);
+
+        return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+    }
+
+    RetVal<EngravingProjectPtr> prj = openEngravingProjectWithoutLayout(in, stylePath, forceMode);
     if (!prj.ret) {
         return prj.ret;
     }
 
-    INotationPtr notation = prj.val->masterNotation()->notation();
+    RetVal<std::string> meta = NotationMeta::metaJson(prj.val->masterScore(), false);
+    if (!meta.ret) {
+        LOGW() << meta.ret.toString();
+        return meta.ret;
+    }
 
     QFile outputFile;
     openOutputFile(outputFile, out);
 
     BackendJsonWriter jsonWriter(&outputFile);
+    jsonWriter.addKey(META_DATA_NAME.c_str());
+    jsonWriter.addValue(QString::fromStdString(meta.val).toUtf8(), false, true);
 
-    bool result = exportScoreMetaData(notation, jsonWriter);
-
-    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+    return make_ret(Ret::Code::Ok);
 }
 
 Ret BackendApi::exportScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath, bool forceMode)
@@ -238,6 +268,57 @@ RetVal<project::INotationProjectPtr> BackendApi::openProject(const muse::io::pat
     return RetVal<INotationProjectPtr>::make_ok(notationProject);
 }
 
+RetVal<EngravingProjectPtr> BackendApi::openEngravingProjectWithoutLayout(const muse::io::path_t& path,
+                                                                          const muse::io::path_t& stylePath,
+                                                                          bool forceMode)
+{
+    TRACEFUNC
+
+    MscReader::Params params;
+    params.filePath = path.toQString();
+    params.mode = mscIoModeBySuffix(io::suffix(path));
+    IF_ASSERT_FAILED(params.mode != MscIoMode::Unknown) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    MscReader reader(params);
+    Ret ret = reader.open();
+    if (!ret) {
+        LOGE() << "failed open: " << path << ", ret: " << ret.toString();
+        return ret;
+    }
+
+    EngravingProjectPtr engravingProject = EngravingProject::create(nullptr);
+    engravingProject->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>(path));
+
+    SettingsCompat settingsCompat;
+    ret = engravingProject->loadMscz(reader, settingsCompat, forceMode);
+    if (!ret) {
+        LOGE() << "failed load: " << path << ", ret: " << ret.toString();
+        return ret;
+    }
+
+    MasterScore* masterScore = engravingProject->masterScore();
+    IF_ASSERT_FAILED(masterScore) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    //! NOTE Updates stay locked, so setting up the master score does not lay it out
+    masterScore->lockUpdates(true);
+
+    ret = engravingProject->setupMasterScore(forceMode);
+    if (!ret) {
+        return ret;
+    }
+
+    if (!stylePath.empty()) {
+        muse::io::File styleFile(stylePath);
+        masterScore->loadStyle(styleFile);
+    }
+
+    return RetVal<EngravingProjectPtr>::make_ok(engravingProject);
+}
+
 PageList BackendApi::pages(const INotationPtr notation)
 {
     auto elements = notation->elements();
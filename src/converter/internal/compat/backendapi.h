@@ -33,6 +33,7 @@
 #include "io/ifilesystem.h"
 #include "project/iprojectcreator.h"
 #include "project/inotationwritersregister.h"
+#include "engraving/engravingproject.h"
 
 namespace mu::engraving {
 class Score;
@@ -51,7 +52,7 @@ public:
     static muse::Ret exportScoreMedia(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& highlightConfigPath,
                                       const muse::io::path_t& stylePath = "", bool forceMode = false);
     static muse::Ret exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
-                                     bool forceMode = false);
+                                     bool forceMode = false, bool withLayoutData = false);
     static muse::Ret exportScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
                                       bool forceMode = false);
     static muse::Ret exportScorePartsPdfs(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
@@ -66,6 +67,9 @@ private:
 
     static muse::RetVal<project::INotationProjectPtr> openProject(const muse::io::path_t& path,
                                                                   const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false);
+    static muse::RetVal<engraving::EngravingProjectPtr> openEngravingProjectWithoutLayout(const muse::io::path_t& path,
+                                                                                         const muse::io::path_t& stylePath,
+                                                                                         bool forceMode = false);
 
     static notation::PageList pages(const notation::INotationPtr notation);
 
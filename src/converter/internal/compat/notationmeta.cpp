@@ -52,7 +52,7 @@ static bool shouldTryRecognizeText(const Text* text)
     return (int)(type) >= (int)TextStyleType::USER1 && (int)(type) <= (int)TextStyleType::USER12;
 }
 
-static QString recognizeTitle(const mu::engraving::Score* score)
+static QString recognizeTitle(const mu::engraving::Score* score, bool withLayoutData)
 {
     const MeasureBase* mb = score->first();
     if (!mb || !mb->isVBox()) {
@@ -77,7 +77,8 @@ static QString recognizeTitle(const mu::engraving::Score* score)
             continue;
         }
 
-        if (RealIsEqual(text->size(), maxFontSize) && text->y() > minY) {
+        //! NOTE Without layout data the texts have no position, the first of the largest ones wins
+        if (RealIsEqual(text->size(), maxFontSize) && (!withLayoutData || text->y() > minY)) {
             continue;
         }
 
@@ -124,21 +125,26 @@ RetVal<std::string> NotationMeta::metaJson(notation::INotationPtr notation)
         return make_ret(Ret::Code::UnknownError);
     }
 
-    mu::engraving::Score* score = notation->elements()->msScore();
+    return metaJson(notation->elements()->msScore());
+}
 
+RetVal<std::string> NotationMeta::metaJson(mu::engraving::Score* score, bool withLayoutData)
+{
     IF_ASSERT_FAILED(score) {
         return make_ret(Ret::Code::UnknownError);
     }
 
     QJsonObject json;
 
-    json["title"] =  title(score);
+    json["title"] =  title(score, withLayoutData);
     json["subtitle"] =  subtitle(score);
-    json["composer"] =  composer(score);
+    json["composer"] =  composer(score, withLayoutData);
     json["poet"] =  poet(score);
     json["mscoreVersion"] =  score->mscoreVersion().toQString();
     json["fileVersion"] =  score->mscVersion();
-    json["pages"] =  static_cast<int>(score->npages()); // no = operator for size_t
+    if (withLayoutData) {
+        json["pages"] =  static_cast<int>(score->npages()); // no = operator for size_t
+    }
     json["measures"] = static_cast<int>(score->nmeasures()); // no = operator for size_t
     json["hasLyrics"] =  boolToString(score->hasLyrics());
     json["hasHarmonies"] =  boolToString(score->hasHarmonies());
@@ -163,7 +169,7 @@ RetVal<std::string> NotationMeta::metaJson(notation::INotationPtr notation)
     return result;
 }
 
-QString NotationMeta::title(const mu::engraving::Score* score)
+QString NotationMeta::title(const mu::engraving::Score* score, bool withLayoutData)
 {
     QString title;
     const mu::engraving::Text* text = score->getText(mu::engraving::TextStyleType::TITLE);
@@ -176,7 +182,7 @@ QString NotationMeta::title(const mu::engraving::Score* score)
     }
 
     if (title.isEmpty()) {
-        title = recognizeTitle(score);
+        title = recognizeTitle(score, withLayoutData);
     }
 
     if (title.isEmpty()) {
@@ -197,7 +203,7 @@ QString NotationMeta::subtitle(const mu::engraving::Score* score)
     return subtitle;
 }
 
-QString NotationMeta::composer(const mu::engraving::Score* score)
+QString NotationMeta::composer(const mu::engraving::Score* score, bool withLayoutData)
 {
     QString composer;
     const mu::engraving::Text* text = score->getText(mu::engraving::TextStyleType::COMPOSER);
@@ -209,7 +215,7 @@ QString NotationMeta::composer(const mu::engraving::Score* score)
         composer = score->metaTag(u"composer");
     }
 
-    if (composer.isEmpty()) {
+    if (composer.isEmpty() && withLayoutData) {
         composer = recognizeComposer(score);
     }
 
@@ -35,10 +35,14 @@ class NotationMeta
 public:
     static muse::RetVal<std::string> metaJson(notation::INotationPtr notation);
 
+    //! NOTE Without layout data, the fields that depend on the score being laid out
+    //! (page count, position-based composer recognition) are not written
+    static muse::RetVal<std::string> metaJson(mu::engraving::Score* score, bool withLayoutData = true);
+
 private:
-    static QString title(const mu::engraving::Score* score);
+    static QString title(const mu::engraving::Score* score, bool withLayoutData);
     static QString subtitle(const mu::engraving::Score* score);
-    static QString composer(const mu::engraving::Score* score);
+    static QString composer(const mu::engraving::Score* score, bool withLayoutData);
     static QString poet(const mu::engraving::Score* score);
     static QString timesig(const mu::engraving::Score* score);
     static std::pair<int, QString> tempo(const mu::engraving::Score* score);
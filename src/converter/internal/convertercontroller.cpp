@@ -25,10 +25,18 @@
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QCoreApplication>
+#include <QTemporaryDir>
+
+#include <chrono>
+#include <thread>
 
 #include "defer.h"
 #include "global/io/file.h"
 #include "global/io/dir.h"
+#include "global/concurrency/taskscheduler.h"
+#include "draw/painter.h"
+#include "draw/displaylistpaintprovider.h"
 
 #include "convertercodes.h"
 #include "compat/backendapi.h"
@@ -47,11 +55,39 @@ static const std::string PNG_SUFFIX = "png";
 static const std::string SVG_SUFFIX = "svg";
 static const std::string MP3_SUFFIX = "mp3";
 
+static muse::TaskScheduler& exportTaskScheduler()
+{
+    static muse::TaskScheduler scheduler;
+    return scheduler;
+}
+
+//! NOTE Paints the notation for printing once, so that its pages are recorded into display lists
+//! (see Paint::paintPageCached). Painting it again with the same dpi only replays the recorded pages
+//! and doesn't touch the engraving DOM anymore
+static void recordPagesForPrinting(const INotationPtr& notation, int deviceDpi)
+{
+    TRACEFUNC;
+
+    muse::draw::Painter painter(std::make_shared<muse::draw::DisplayListPaintProvider>(), "record_pages");
+
+    INotationPainting::Options opt;
+    opt.deviceDpi = deviceDpi;
+    opt.isRecordPages = true;
+    notation->painting()->paintPdf(&painter, opt);
+
+    painter.endDraw();
+}
+
 Ret ConverterController::batchConvert(const muse::io::path_t& batchJobFile, const muse::io::path_t& stylePath, bool forceMode,
-                                      const String& soundProfile, const muse::UriQuery& extensionUri, muse::ProgressPtr progress)
+                                      const String& soundProfile, const muse::UriQuery& extensionUri, muse::ProgressPtr progress,
+                                      size_t workers)
 {
     TRACEFUNC;
 
+    if (workers > 1) {
+        return batchConvertInWorkers(batchJobFile, workers, progress);
+    }
+
     if (progress) {
         progress->start();
     }
@@ -75,10 +111,18 @@ Ret ConverterController::batchConvert(const muse::io::path_t& batchJobFile, cons
             progress->progress(current, total, job.in.toStdString());
         }
 
+        auto startTime = std::chrono::steady_clock::now();
+
         Ret ret = fileConvert(job.in, job.out, stylePath, forceMode, soundProfile, extensionUri, job.transposeOptions);
+
+        auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
         if (!ret) {
+            LOGE() << "job failed in " << elapsedMs << " ms, in: " << job.in << ", out: " << job.out;
             errors.emplace_back(String(u"failed convert, err: %1, in: %2, out: %3")
                                 .arg(String::fromStdString(ret.toString())).arg(job.in.toString()).arg(job.out.toString()));
+        } else {
+            LOGI() << "job done in " << elapsedMs << " ms, in: " << job.in << ", out: " << job.out;
         }
     }
 
@@ -96,6 +140,130 @@ Ret ConverterController::batchConvert(const muse::io::path_t& batchJobFile, cons
     return ret;
 }
 
+//! NOTE The worker is the same application, started with the same arguments,
+//! except that it processes its own part of the jobs and runs them sequentially
+static std::vector<std::string> workerArguments(const QStringList& appArguments, const QString& workerJobFile)
+{
+    std::vector<std::string> args;
+
+    // NOTE: skip the first argument - the program name
+    for (int i = 1; i < appArguments.size(); ++i) {
+        const QString& arg = appArguments.at(i);
+        if (arg == "-j" || arg == "--job" || arg == "--batch-workers") {
+            ++i; // skip the value
+            continue;
+        }
+
+        if (arg.startsWith("--job=") || arg.startsWith("--batch-workers=")) {
+            continue;
+        }
+
+        args.push_back(arg.toStdString());
+    }
+
+    args.push_back("-j");
+    args.push_back(workerJobFile.toStdString());
+
+    return args;
+}
+
+Ret ConverterController::batchConvertInWorkers(const muse::io::path_t& batchJobFile, size_t workers, muse::ProgressPtr progress)
+{
+    TRACEFUNC;
+
+    if (progress) {
+        progress->start();
+    }
+
+    auto finish = [progress](const Ret& ret) {
+        if (progress) {
+            progress->finish(ProgressResult(ret));
+        }
+        return ret;
+    };
+
+    QFile file(batchJobFile.toQString());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return finish(make_ret(Err::BatchJobFileFailedOpen));
+    }
+
+    QJsonParseError err;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &err);
+    if (err.error != QJsonParseError::NoError || !doc.isArray()) {
+        return finish(make_ret(Err::BatchJobFileFailedParse, err.errorString().toStdString()));
+    }
+
+    const QJsonArray jobs = doc.array();
+    workers = std::min(workers, static_cast<size_t>(jobs.size()));
+    if (workers == 0) {
+        return finish(make_ret(Ret::Code::Ok));
+    }
+
+    //! NOTE Jobs are dealt out in turn, so that heavy scores listed next to each other
+    //! end up in different workers
+    std::vector<QJsonArray> workerJobs(workers);
+    for (int i = 0; i < jobs.size(); ++i) {
+        workerJobs[i % workers].append(jobs.at(i));
+    }
+
+    QTemporaryDir tempDir;
+    if (!tempDir.isValid()) {
+        return finish(make_ret(Err::UnknownError, tempDir.errorString().toStdString()));
+    }
+
+    std::vector<QString> workerJobFiles;
+    for (size_t w = 0; w < workers; ++w) {
+        QString path = tempDir.filePath(QString("job_%1.json").arg(w));
+        QFile workerFile(path);
+        if (!workerFile.open(QIODevice::WriteOnly)) {
+            return finish(make_ret(Err::OutFileFailedOpen, path.toStdString()));
+        }
+
+        workerFile.write(QJsonDocument(workerJobs[w]).toJson(QJsonDocument::Compact));
+        workerJobFiles.push_back(path);
+    }
+
+    const QStringList appArguments = QCoreApplication::arguments();
+    const std::string program = QCoreApplication::applicationFilePath().toStdString();
+
+    LOGI() << "distribute " << jobs.size() << " jobs over " << workers << " workers";
+
+    std::vector<int> exitCodes(workers, 0);
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+
+    for (size_t w = 0; w < workers; ++w) {
+        std::vector<std::string> args = workerArguments(appArguments, workerJobFiles[w]);
+        threads.emplace_back([this, w, program, args = std::move(args), &exitCodes]() {
+            auto startTime = std::chrono::steady_clock::now();
+            exitCodes[w] = process()->execute(program, args);
+            auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+            LOGI() << "worker " << w << " finished in " << elapsedMs << " ms, exit code: " << exitCodes[w];
+        });
+    }
+
+    StringList errors;
+
+    int64_t total = static_cast<int64_t>(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        threads[w].join();
+
+        if (progress) {
+            progress->progress(static_cast<int64_t>(w + 1), total, workerJobFiles[w].toStdString());
+        }
+
+        if (exitCodes[w] != 0) {
+            errors.emplace_back(String(u"worker %1 failed, exit code: %2").arg(w).arg(exitCodes[w]));
+        }
+    }
+
+    if (!errors.empty()) {
+        return finish(make_ret(Err::ConvertFailed, errors.join(u"\n").toStdString()));
+    }
+
+    return finish(make_ret(Ret::Code::Ok));
+}
+
 Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io::path_t& out,
                                      const muse::io::path_t& stylePath,
                                      bool forceMode,
@@ -401,18 +569,30 @@ Ret ConverterController::convertScorePartsToPdf(INotationWriterPtr writer, IMast
     TRACEFUNC;
 
     INotationPtrList notations;
+    std::vector<muse::io::path_t> partOuts;
     for (const IExcerptNotationPtr& e : masterNotation->excerpts()) {
         notations.push_back(e->notation());
-    }
 
-    for (size_t i = 0; i < notations.size(); ++i) {
-        QString partName = notations[i]->name();
+        QString partName = e->notation()->name();
         QString baseName = QString::fromStdString(io::completeBasename(out).toStdString());
-        muse::io::path_t partOut = io::dirpath(out) + "/" + baseName.replace("*", partName).toStdString() + ".pdf";
+        partOuts.push_back(io::dirpath(out) + "/" + baseName.replace("*", partName).toStdString() + ".pdf");
+    }
 
-        File file(partOut);
+    //! NOTE The parts are created and laid out when the project is loaded, and the engraving DOM
+    //! may only be accessed from this thread. So the pages of all the parts are recorded here first,
+    //! then the writers only replay them, and the parts are written concurrently
+    const int pdfDpi = imagesExportConfiguration()->exportPdfDpiResolution();
+    for (const INotationPtr& notation : notations) {
+        recordPagesForPrinting(notation, pdfDpi);
+    }
+
+    std::vector<Ret> rets(notations.size(), make_ret(Ret::Code::Ok));
+
+    exportTaskScheduler().parallelFor(notations.size(), [&](size_t i) {
+        File file(partOuts[i]);
         if (!file.open(File::WriteOnly)) {
-            return make_ret(Err::OutFileFailedOpen);
+            rets[i] = make_ret(Err::OutFileFailedOpen);
+            return;
         }
 
         INotationWriter::Options options {
@@ -421,11 +601,18 @@ Ret ConverterController::convertScorePartsToPdf(INotationWriterPtr writer, IMast
 
         Ret ret = writer->write(notations[i], file, options);
         if (!ret) {
-            LOGE() << "failed write, err: " << ret.toString() << ", path: " << partOut;
-            return make_ret(Err::OutFileFailedWrite);
+            LOGE() << "failed write, err: " << ret.toString() << ", path: " << partOuts[i];
+            rets[i] = make_ret(Err::OutFileFailedWrite);
+            return;
         }
 
         file.close();
+    });
+
+    for (const Ret& ret : rets) {
+        if (!ret) {
+            return ret;
+        }
     }
 
     return make_ret(Ret::Code::Ok);
@@ -500,11 +687,11 @@ Ret ConverterController::exportScoreMedia(const muse::io::path_t& in, const muse
 }
 
 Ret ConverterController::exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
-                                         bool forceMode)
+                                         bool forceMode, bool withLayoutData)
 {
     TRACEFUNC;
 
-    return BackendApi::exportScoreMeta(in, out, stylePath, forceMode);
+    return BackendApi::exportScoreMeta(in, out, stylePath, forceMode, withLayoutData);
 }
 
 Ret ConverterController::exportScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
@@ -31,6 +31,8 @@
 #include "project/iprojectrwregister.h"
 #include "context/iglobalcontext.h"
 #include "extensions/iextensionsprovider.h"
+#include "iprocess.h"
+#include "importexport/imagesexport/iimagesexportconfiguration.h"
 
 #include "types/retval.h"
 
@@ -42,6 +44,8 @@ class ConverterController : public IConverterController, public muse::Injectable
     muse::Inject<project::IProjectRWRegister> projectRW = { this };
     muse::Inject<context::IGlobalContext> globalContext = { this };
     muse::Inject<muse::extensions::IExtensionsProvider> extensionsProvider = { this };
+    muse::Inject<muse::IProcess> process = { this };
+    muse::Inject<iex::imagesexport::IImagesExportConfiguration> imagesExportConfiguration = { this };
 
 public:
     ConverterController(const muse::modularity::ContextPtr& iocCtx)
@@ -55,7 +59,8 @@ public:
     muse::Ret batchConvert(const muse::io::path_t& batchJobFile,
                            const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false,
                            const muse::String& soundProfile = muse::String(),
-                           const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr) override;
+                           const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr,
+                           size_t workers = 1) override;
 
     muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out,
                                 const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) override;
@@ -64,7 +69,8 @@ public:
                                const muse::io::path_t& highlightConfigPath = muse::io::path_t(),
                                const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) override;
     muse::Ret exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out,
-                              const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) override;
+                              const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false,
+                              bool withLayoutData = false) override;
     muse::Ret exportScoreParts(const muse::io::path_t& in, const muse::io::path_t& out,
                                const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) override;
     muse::Ret exportScorePartsPdfs(const muse::io::path_t& in, const muse::io::path_t& out,
@@ -88,6 +94,8 @@ private:
 
     muse::RetVal<BatchJob> parseBatchJob(const muse::io::path_t& batchJobFile) const;
 
+    muse::Ret batchConvertInWorkers(const muse::io::path_t& batchJobFile, size_t workers, muse::ProgressPtr progress);
+
     muse::Ret fileConvert(const muse::io::path_t& in, const muse::io::path_t& out,
                           const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false,
                           const muse::String& soundProfile = muse::String(),
@@ -20,11 +20,14 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include "bsp.h"
 #include "engravingitem.h"
 
+#include "containers.h"
+
 using namespace mu;
 
 namespace mu::engraving {
@@ -38,7 +41,7 @@ class InsertItemBspTreeVisitor : public BspTreeVisitor
 public:
     EngravingItem* item;
 
-    inline void visit(std::list<EngravingItem*>* items) { items->push_front(item); }
+    inline void visit(std::vector<EngravingItem*>* items) { items->push_back(item); }
 };
 
 //---------------------------------------------------------
@@ -51,7 +54,7 @@ class RemoveItemBspTreeVisitor : public BspTreeVisitor
 public:
     EngravingItem* item;
 
-    inline void visit(std::list<EngravingItem*>* items) { items->remove(item); }
+    inline void visit(std::vector<EngravingItem*>* items) { muse::remove(*items, item); }
 };
 
 //---------------------------------------------------------
@@ -62,15 +65,17 @@ class FindItemBspTreeVisitor : public BspTreeVisitor
 {
     OBJECT_ALLOCATOR(engraving, FindItemBspTreeVisitor)
 public:
-    std::list<EngravingItem*> foundItems;
+    std::vector<EngravingItem*>* foundItems = nullptr;
 
-    void visit(std::list<EngravingItem*>* items)
+    void visit(std::vector<EngravingItem*>* items)
     {
-        for (auto it = items->begin(); it != items->end(); ++it) {
+        // visit the leaf from its last inserted item, items() then reverses the
+        // whole result, so every leaf ends up in insertion order, the last visited leaf first
+        for (auto it = items->rbegin(); it != items->rend(); ++it) {
             EngravingItem* item = *it;
             if (!item->itemDiscovered) {
                 item->itemDiscovered = true;
-                foundItems.push_front(item);
+                foundItems->push_back(item);
             }
         }
     }
@@ -107,7 +112,10 @@ void BspTree::initialize(const RectF& rec, int n)
 
     m_nodes.resize((1 << (m_depth + 1)) - 1);
     m_leaves.resize(1LL << m_depth);
-    std::fill(m_leaves.begin(), m_leaves.end(), std::list<EngravingItem*>());
+    // keep the capacity of the leaves, the tree is rebuilt after every layout
+    for (std::vector<EngravingItem*>& leaf : m_leaves) {
+        leaf.clear();
+    }
     initialize(rec, m_depth, 0);
 }
 
@@ -150,35 +158,46 @@ void BspTree::remove(EngravingItem* element)
 
 std::vector<EngravingItem*> BspTree::items(const RectF& rec)
 {
-    FindItemBspTreeVisitor findVisitor;
-    climbTree(&findVisitor, rec);
     std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
-        if (e->pageBoundingRect().intersects(rec)) {
-            l.push_back(e);
-        }
-    }
+    items(rec, l);
     return l;
 }
 
-//---------------------------------------------------------
-//   items
-//---------------------------------------------------------
-
 std::vector<EngravingItem*> BspTree::items(const PointF& pos)
 {
+    std::vector<EngravingItem*> l;
+    items(pos, l);
+    return l;
+}
+
+void BspTree::items(const RectF& rec, std::vector<EngravingItem*>& result)
+{
+    result.clear();
+
     FindItemBspTreeVisitor findVisitor;
+    findVisitor.foundItems = &result;
+    climbTree(&findVisitor, rec);
+
+    std::reverse(result.begin(), result.end());
+    muse::remove_if(result, [&rec](EngravingItem* e) {
+        e->itemDiscovered = false;
+        return !e->pageBoundingRect().intersects(rec);
+    });
+}
+
+void BspTree::items(const PointF& pos, std::vector<EngravingItem*>& result)
+{
+    result.clear();
+
+    FindItemBspTreeVisitor findVisitor;
+    findVisitor.foundItems = &result;
     climbTree(&findVisitor, pos);
 
-    std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
+    std::reverse(result.begin(), result.end());
+    muse::remove_if(result, [&pos](EngravingItem* e) {
         e->itemDiscovered = false;
-        if (e->contains(pos)) {
-            l.push_back(e);
-        }
-    }
-    return l;
+        return !e->contains(pos);
+    });
 }
 
 //---------------------------------------------------------
@@ -207,7 +226,9 @@ void BspTree::nearestNeighbor(const PointF& pos, EngravingItem** bestItem, doubl
 
     // Base case: go through the items in the leaf node (if any), and update bestItem/bestDistance accordingly
     if (node->type == Node::Type::LEAF) {
-        for (auto item : m_leaves[node->leafIndex]) {
+        const std::vector<EngravingItem*>& leaf = m_leaves[node->leafIndex];
+        for (auto it = leaf.rbegin(); it != leaf.rend(); ++it) {
+            EngravingItem* item = *it;
             PointF itemPos = item->pageBoundingRect().center();
             double currDistance = std::sqrt(std::pow(pos.x() - itemPos.x(), 2) + std::pow(pos.y() - itemPos.y(), 2));
             if (currDistance < bestDistance) {
@@ -23,7 +23,7 @@
 #ifndef MU_ENGRAVING_BSP_H
 #define MU_ENGRAVING_BSP_H
 
-#include <list>
+#include <vector>
 
 #include "global/allocator.h"
 #include "types/string.h"
@@ -61,16 +61,13 @@ private:
     void climbTree(BspTreeVisitor* visitor, const PointF& pos, int index = 0);
     void climbTree(BspTreeVisitor* visitor, const RectF& rect, int index = 0);
 
-    void findItems(std::list<EngravingItem*>* foundItems, const RectF& rect, int index);
-    void findItems(std::list<EngravingItem*>* foundItems, const PointF& pos, int index);
-
     void nearestNeighbor(const PointF& pos, EngravingItem** bestItem, double& bestDistance, int nodeIndex = 0);
 
     RectF rectForIndex(int index) const;
 
     unsigned int m_depth = 0;
     std::vector<Node> m_nodes;
-    std::vector<std::list<EngravingItem*> > m_leaves;
+    std::vector<std::vector<EngravingItem*> > m_leaves;
     int m_leafCnt = 0;
     RectF m_rect;
 
@@ -86,6 +83,11 @@ public:
     std::vector<EngravingItem*> items(const RectF& rect);
     std::vector<EngravingItem*> items(const PointF& pos);
 
+    // Same as above, but fill the caller's buffer so that repeated queries
+    // (painting, hit-testing, lasso selection) can reuse its capacity
+    void items(const RectF& rect, std::vector<EngravingItem*>& result);
+    void items(const PointF& pos, std::vector<EngravingItem*>& result);
+
     EngravingItem* nearestNeighbor(const PointF& pos);
 
     int leafCount() const { return m_leafCnt; }
@@ -110,7 +112,7 @@ class BspTreeVisitor
     OBJECT_ALLOCATOR(engraving, BspTreeVisitor)
 public:
     virtual ~BspTreeVisitor() {}
-    virtual void visit(std::list<EngravingItem*>* items) = 0;
+    virtual void visit(std::vector<EngravingItem*>* items) = 0;
 };
 } // namespace mu::engraving
 #endif
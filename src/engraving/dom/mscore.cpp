@@ -47,6 +47,7 @@ bool MScore::useFallbackFont     = true;
 
 bool MScore::saveTemplateMode = false;
 bool MScore::noGui = false;
+bool MScore::parallelLayout = false;
 
 int MScore::_vRaster;
 int MScore::_hRaster;
@@ -230,6 +230,7 @@ public:
 
     static bool saveTemplateMode;
     static bool noGui;
+    static bool parallelLayout;
 
     static bool noExcerpts;
     static bool noImages;
@@ -59,19 +59,33 @@ Page::Page(RootItem* parent)
 //---------------------------------------------------------
 
 std::vector<EngravingItem*> Page::items(const RectF& rect)
+{
+    std::vector<EngravingItem*> result;
+    items(rect, result);
+    return result;
+}
+
+std::vector<EngravingItem*> Page::items(const PointF& point)
+{
+    std::vector<EngravingItem*> result;
+    items(point, result);
+    return result;
+}
+
+void Page::items(const RectF& rect, std::vector<EngravingItem*>& result)
 {
     if (!m_bspTreeValid) {
         doRebuildBspTree();
     }
-    return bspTree.items(rect);
+    bspTree.items(rect, result);
 }
 
-std::vector<EngravingItem*> Page::items(const PointF& point)
+void Page::items(const PointF& point, std::vector<EngravingItem*>& result)
 {
     if (!m_bspTreeValid) {
         doRebuildBspTree();
     }
-    return bspTree.items(point);
+    bspTree.items(point, result);
 }
 
 //---------------------------------------------------------
@@ -23,12 +23,17 @@
 #ifndef MU_ENGRAVING_PAGE_H
 #define MU_ENGRAVING_PAGE_H
 
+#include <memory>
 #include <vector>
 
 #include "engravingitem.h"
 #include "bsp.h"
 #include "text.h"
 
+namespace muse::draw {
+struct DisplayList;
+}
+
 namespace mu::engraving {
 class RootItem;
 class Factory;
@@ -76,7 +81,9 @@ public:
 
     std::vector<EngravingItem*> items(const RectF& r);
     std::vector<EngravingItem*> items(const PointF& p);
-    void invalidateBspTree() { m_bspTreeValid = false; }
+    void items(const RectF& r, std::vector<EngravingItem*>& result);
+    void items(const PointF& p, std::vector<EngravingItem*>& result);
+    void invalidateBspTree() { m_bspTreeValid = false; m_paintCache = PaintCache(); }
     PointF pagePos() const override { return PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     RectF tbbox() const;                             // tight bounding box, excluding white space
@@ -88,6 +95,17 @@ public:
 
     Text* layoutHeaderFooter(int area, const String& s) const;
 
+    //! NOTE The recorded painting of the page items, for painting the page again without the layout changed
+    //! (e.g. when exporting it several times). Dropped together with the bsp tree, i.e. whenever the page is laid out
+    struct PaintCache {
+        std::shared_ptr<const muse::draw::DisplayList> displayList;
+        int deviceDpi = 0;
+        size_t pageCount = 0;
+    };
+
+    const PaintCache& paintCache() const { return m_paintCache; }
+    void setPaintCache(const PaintCache& cache) { m_paintCache = cache; }
+
 private:
 
     friend class Factory;
@@ -102,6 +120,8 @@ private:
 
     BspTree bspTree;
     bool m_bspTreeValid = false;
+
+    PaintCache m_paintCache;
 };
 } // namespace mu::engraving
 #endif
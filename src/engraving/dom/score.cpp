@@ -163,6 +163,7 @@ Score::Score(const modularity::ContextPtr& iocCtx)
 
     m_fileDivision = Constants::DIVISION;
     m_style = DefaultStyle::defaultStyle();
+    m_layoutOptions.isParallelLayout = MScore::parallelLayout;
 
     m_rootItem = new RootItem(this);
     m_rootItem->init();
@@ -4195,6 +4196,8 @@ void Score::lassoSelect(const RectF& bbox)
 {
     select(0, SelectType::SINGLE, 0);
     RectF fr(bbox.normalized());
+    std::vector<EngravingItem*> items;
+    std::vector<EngravingItem*> itemsToSelect;
     for (Page* page : pages()) {
         RectF pr(page->ldata()->bbox());
         RectF frr(fr.translated(-page->pos()));
@@ -4205,8 +4208,8 @@ void Score::lassoSelect(const RectF& bbox)
             break;
         }
 
-        std::vector<EngravingItem*> items = page->items(frr);
-        std::vector<EngravingItem*> itemsToSelect;
+        page->items(frr, items);
+        itemsToSelect.clear();
 
         for (EngravingItem* item : items) {
             if (frr.contains(item->pageBoundingRect())) {
@@ -6019,8 +6022,8 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
         if (!spanner->staff()->visible()) {
             continue;
         }
-        start = std::min(st, spanner->tick());
-        end = std::max(et, spanner->tick2());
+        start = std::min(start, spanner->tick());
+        end = std::max(end, spanner->tick2());
     }
 
     m_engravingFont = engravingFonts()->fontByName(style().value(Sid::musicalSymbolFont).value<String>().toStdString());
@@ -899,6 +899,7 @@ public:
     const LayoutOptions& layoutOptions() const { return m_layoutOptions; }
     void setLayoutMode(LayoutMode lm) { m_layoutOptions.mode = lm; }
     void setShowVBox(bool v) { m_layoutOptions.isShowVBox = v; }
+    void setParallelLayout(bool v) { m_layoutOptions.isParallelLayout = v; }
     double noteHeadWidth() const { return m_layoutOptions.noteHeadWidth; }
     void setNoteHeadWidth(double n) { m_layoutOptions.noteHeadWidth = n; }
 
@@ -21,6 +21,9 @@
  */
 
 #include "segmentlist.h"
+
+#include <algorithm>
+
 #include "segment.h"
 #include "score.h"
 
@@ -29,6 +32,25 @@
 using namespace mu;
 
 namespace mu::engraving {
+//---------------------------------------------------------
+//   SegmentList
+//    the index is not copied, it refers to the segments of the other list
+//---------------------------------------------------------
+
+SegmentList::SegmentList(const SegmentList& other)
+    : m_first(other.m_first), m_last(other.m_last), m_size(other.m_size)
+{
+}
+
+SegmentList& SegmentList::operator=(const SegmentList& other)
+{
+    m_first = other.m_first;
+    m_last = other.m_last;
+    m_size = other.m_size;
+    invalidateIndex();
+    return *this;
+}
+
 //---------------------------------------------------------
 //   clone
 //---------------------------------------------------------
@@ -134,6 +156,7 @@ void SegmentList::check()
 
 void SegmentList::insert(Segment* e, Segment* el)
 {
+    invalidateIndex();
     if (el == 0) {
         push_back(e);
     } else if (el == first()) {
@@ -167,6 +190,7 @@ void SegmentList::remove(Segment* e)
         ASSERT_X(String(u"segment %1 not in list").arg(String::fromAscii(e->subTypeName())));
     }
 #endif
+    invalidateIndex();
     --m_size;
     if (e == m_first) {
         m_first = m_first->next();
@@ -193,6 +217,7 @@ void SegmentList::remove(Segment* e)
 
 void SegmentList::push_back(Segment* e)
 {
+    invalidateIndex();
     ++m_size;
     e->setNext(0);
     if (m_last) {
@@ -211,6 +236,7 @@ void SegmentList::push_back(Segment* e)
 
 void SegmentList::push_front(Segment* e)
 {
+    invalidateIndex();
     ++m_size;
     e->setPrev(0);
     if (m_first) {
@@ -232,6 +258,33 @@ Segment* SegmentList::firstCRSegment() const
     return first(SegmentType::ChordRest);
 }
 
+//---------------------------------------------------------
+//   lowerBound
+//---------------------------------------------------------
+
+Segment* SegmentList::lowerBound(const Fraction& rtick) const
+{
+    if (!m_indexValid) {
+        rebuildIndex();
+    }
+
+    auto it = std::lower_bound(m_index.begin(), m_index.end(), rtick, [](const Segment* s, const Fraction& t) {
+        return s->rtick() < t;
+    });
+
+    return it != m_index.end() ? *it : nullptr;
+}
+
+void SegmentList::rebuildIndex() const
+{
+    m_index.clear();
+    m_index.reserve(m_size);
+    for (Segment* s = m_first; s; s = s->next()) {
+        m_index.push_back(s);
+    }
+    m_indexValid = true;
+}
+
 //---------------------------------------------------------
 //   first
 //---------------------------------------------------------
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "segment.h"
 
 namespace mu::engraving {
@@ -35,7 +37,9 @@ class SegmentList
 {
 public:
     SegmentList() { clear(); }
-    void clear() { m_first = m_last = 0; m_size = 0; }
+    SegmentList(const SegmentList& other);
+    SegmentList& operator=(const SegmentList& other);
+    void clear() { m_first = m_last = 0; m_size = 0; invalidateIndex(); }
 #ifndef NDEBUG
     void check();
 #else
@@ -53,6 +57,12 @@ public:
     Segment* last(ElementFlag) const;
     Segment* last(SegmentType) const;
     Segment* firstCRSegment() const;
+
+    //! NOTE Returns the first segment with the relative tick not less than `rtick`, or nullptr.
+    //! The segments are kept ordered by their relative ticks, so it is a binary search
+    //! over a flat index of the list, which is rebuilt on the first lookup after the list changed
+    Segment* lowerBound(const Fraction& rtick) const;
+
     void remove(Segment*);
     void push_back(Segment*);
     void push_front(Segment*);
@@ -84,9 +94,15 @@ public:
 
 private:
 
+    void invalidateIndex() { m_indexValid = false; }
+    void rebuildIndex() const;
+
     Segment* m_first = nullptr;          // First item of segment list
     Segment* m_last = nullptr;           // Last item of segment list
     int m_size = 0;                      // Number of items in segment list
+
+    mutable std::vector<Segment*> m_index;
+    mutable bool m_indexValid = false;
 };
 
 // Segment* begin(SegmentList& l) { return l.first(); }
@@ -1845,7 +1845,9 @@ void ChangeInstrumentShort::flip(EditData*)
     std::list<StaffName> s = part->shortNames(tick);
     part->setShortNames(text, tick);
     text = s;
-    part->score()->setLayoutAll();
+    // names only take effect from tick onwards
+    Score* score = part->score();
+    score->setLayout(tick, score->endTick(), part->staves().front()->idx(), part->staves().back()->idx());
 }
 
 //---------------------------------------------------------
@@ -1864,7 +1866,9 @@ void ChangeInstrumentLong::flip(EditData*)
     std::list<StaffName> s = part->longNames(tick);
     part->setLongNames(text, tick);
     text = s;
-    part->score()->setLayoutAll();
+    // names only take effect from tick onwards
+    Score* score = part->score();
+    score->setLayout(tick, score->endTick(), part->staves().front()->idx(), part->staves().back()->idx());
 }
 
 //---------------------------------------------------------
@@ -2811,7 +2815,8 @@ void ChangeClefType::flip(EditData*)
     clef->staff()->setClef(clef);
     Segment* segment = clef->segment();
     updateNoteLines(segment, clef->track());
-    clef->triggerLayoutAll();        // TODO: reduce layout to clef range
+    clef->triggerLayout();
+    clef->score()->setLayout(clef->staff()->nextClefTick(clef->tick()), clef->staffIdx());
 
     concertClef     = ocl;
     transposingClef = otc;
@@ -163,21 +163,21 @@ Segment* Score::tick2segment(const Fraction& t, bool first, SegmentType st, bool
         LOGD() << "no measure for tick " << tick.ticks();
         return 0;
     }
-    for (Segment* segment   = m->first(st); segment;) {
-        Fraction t1       = segment->tick();
-        Segment* nsegment = segment->next(st);
-        if (tick == t1) {
-            if (first) {
-                return segment;
-            } else {
-                if (!nsegment || tick < nsegment->tick()) {
-                    return segment;
-                }
-            }
+
+    //! NOTE Compare the relative ticks, so that the absolute tick of every segment isn't computed
+    const Fraction rtick = tick - m->tick();
+    Segment* found = nullptr;
+    for (Segment* segment = m->segments().lowerBound(rtick); segment && segment->rtick() == rtick; segment = segment->next()) {
+        if (!(segment->segmentType() & st)) {
+            continue;
+        }
+        if (first) {
+            return segment;
         }
-        segment = nsegment;
+        // the last one at this tick
+        found = segment;
     }
-    return 0;
+    return found;
 }
 
 Segment* Score::tick2segment(const Fraction& tick) const
@@ -204,17 +204,23 @@ Segment* Score::tick2leftSegment(const Fraction& tick, bool useMMrest, SegmentTy
         return 0;
     }
 
-    // loop over all segments
-    Segment* ps = 0;
-    for (Segment* s = m->first(segType); s; s = s->next(segType)) {
-        if (tick < s->tick()) {
+    const Fraction rtick = tick - m->tick();
+    Segment* s = m->segments().lowerBound(rtick);
+
+    // the first one at this tick
+    for (Segment* ss = s; ss && ss->rtick() == rtick; ss = ss->next()) {
+        if (ss->segmentType() & segType) {
+            return ss;
+        }
+    }
+
+    // or the last one before it
+    for (Segment* ps = s ? s->prev() : m->last(); ps; ps = ps->prev()) {
+        if (ps->segmentType() & segType) {
             return ps;
-        } else if (tick == s->tick()) {
-            return s;
         }
-        ps = s;
     }
-    return ps;
+    return 0;
 }
 
 //---------------------------------------------------------
@@ -230,13 +236,13 @@ Segment* Score::tick2rightSegment(const Fraction& tick, bool useMMrest, SegmentT
         //LOGD("tick2nearestSegment(): not found tick %d", tick.ticks());
         return 0;
     }
-    // loop over all segments
-    for (Segment* s = m->first(segType); s; s = s->next1(segType)) {
-        if (tick <= s->tick()) {
-            return s;
-        }
+    Segment* s = m->segments().lowerBound(tick - m->tick());
+    if (!s) {
+        // continue with the next measures
+        Segment* last = m->last();
+        return last ? last->next1(segType) : 0;
     }
-    return 0;
+    return (s->segmentType() & segType) ? s : s->next1(segType);
 }
 
 //---------------------------------------------------------
@@ -59,6 +59,7 @@ EngravingFont::EngravingFont(const EngravingFont& other)
 {
     m_loaded = false;
     m_symbols  = other.m_symbols;
+    m_smuflAnchors = other.m_smuflAnchors;
     m_name     = other.m_name;
     m_family   = other.m_family;
     m_fontPath = other.m_fontPath;
@@ -176,7 +177,12 @@ void EngravingFont::loadGlyphsWithAnchors(const JsonObject& glyphsWithAnchors)
             double x = arr.at(0).toDouble();
             double y = arr.at(1).toDouble();
 
-            sym.smuflAnchors[search->second] = PointF(x, -y) * SPATIUM20;
+            if (sym.smuflAnchorsIdx < 0) {
+                sym.smuflAnchorsIdx = static_cast<int>(m_smuflAnchors.size());
+                m_smuflAnchors.emplace_back();
+            }
+
+            m_smuflAnchors[sym.smuflAnchorsIdx][static_cast<size_t>(search->second)] = PointF(x, -y) * SPATIUM20;
         }
     }
 }
@@ -1033,14 +1039,12 @@ PointF EngravingFont::smuflAnchor(SymId symId, SmuflAnchorId anchorId, double ma
         return engravingFonts()->fallbackFont()->smuflAnchor(symId, anchorId, mag);
     }
 
-    const std::map<SmuflAnchorId, PointF>& smuflAnchors = sym(symId).smuflAnchors;
-
-    auto it = smuflAnchors.find(anchorId);
-    if (it == smuflAnchors.cend()) {
+    const int smuflAnchorsIdx = sym(symId).smuflAnchorsIdx;
+    if (smuflAnchorsIdx < 0) {
         return PointF();
     }
 
-    return it->second * mag;
+    return m_smuflAnchors[smuflAnchorsIdx][static_cast<size_t>(anchorId)] * mag;
 }
 
 // =============================================
@@ -21,6 +21,7 @@
  */
 #pragma once
 
+#include <array>
 #include <unordered_map>
 
 #include "iengravingfont.h"
@@ -98,13 +99,19 @@ private:
 
     friend class SymbolFonts;
 
+    static constexpr size_t SMUFL_ANCHOR_COUNT = static_cast<size_t>(SmuflAnchorId::opticalCenter) + 1;
+
+    //! NOTE Indexed by SmuflAnchorId, an absent anchor is a null point
+    using SmuflAnchors = std::array<PointF, SMUFL_ANCHOR_COUNT>;
+
     struct Sym {
         char32_t code;
         RectF bbox;
         Shape shapeWithCutouts;
         double advance = 0.0;
 
-        std::map<SmuflAnchorId, PointF> smuflAnchors;
+        //! NOTE Index in m_smuflAnchors, only some of the symbols have anchors
+        int smuflAnchorsIdx = -1;
         SymIdList subSymbolIds;
 
         bool isValid() const
@@ -133,6 +140,7 @@ private:
 
     bool m_loaded = false;
     std::vector<Sym> m_symbols;
+    std::vector<SmuflAnchors> m_smuflAnchors;
     mutable muse::draw::Font m_font;
 
     std::string m_name;
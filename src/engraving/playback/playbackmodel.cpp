@@ -60,6 +60,60 @@ static const Harmony* findChordSymbol(const EngravingItem* item)
     return nullptr;
 }
 
+static void appendEvents(const PlaybackEventsMap& source, PlaybackEventsMap& destination)
+{
+    for (const auto& pair : source) {
+        PlaybackEventList& events = destination[pair.first];
+        events.insert(events.end(), pair.second.cbegin(), pair.second.cend());
+    }
+}
+
+static timestamp_t firstDifferentTimestamp(const DynamicLevelMap& first, const DynamicLevelMap& second)
+{
+    auto firstIt = first.cbegin();
+    auto secondIt = second.cbegin();
+
+    while (firstIt != first.cend() && secondIt != second.cend()) {
+        if (*firstIt != *secondIt) {
+            return std::min(firstIt->first, secondIt->first);
+        }
+
+        ++firstIt;
+        ++secondIt;
+    }
+
+    if (firstIt != first.cend()) {
+        return firstIt->first;
+    }
+
+    if (secondIt != second.cend()) {
+        return secondIt->first;
+    }
+
+    return std::numeric_limits<timestamp_t>::max();
+}
+
+static timestamp_t firstDifferentTimestamp(const DynamicLevelLayers& first, const DynamicLevelLayers& second)
+{
+    static const DynamicLevelMap EMPTY_MAP;
+
+    timestamp_t result = std::numeric_limits<timestamp_t>::max();
+
+    for (const auto& pair : first) {
+        auto search = second.find(pair.first);
+        const DynamicLevelMap& secondMap = search != second.cend() ? search->second : EMPTY_MAP;
+        result = std::min(result, firstDifferentTimestamp(pair.second, secondMap));
+    }
+
+    for (const auto& pair : second) {
+        if (first.find(pair.first) == first.cend()) {
+            result = std::min(result, firstDifferentTimestamp(EMPTY_MAP, pair.second));
+        }
+    }
+
+    return result;
+}
+
 void PlaybackModel::load(Score* score)
 {
     TRACEFUNC;
@@ -69,6 +123,7 @@ void PlaybackModel::load(Score* score)
     }
 
     m_score = score;
+    m_measureFragmentsByPart.clear();
 
     auto changesChannel = score->changesChannel();
     changesChannel.resetOnReceive(this);
@@ -81,6 +136,7 @@ void PlaybackModel::load(Score* score)
         TickBoundaries tickRange = tickBoundaries(range);
         TrackBoundaries trackRange = trackBoundaries(range);
 
+        invalidateMeasureFragments(range, trackRange);
         clearExpiredTracks();
         clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo);
@@ -116,6 +172,7 @@ void PlaybackModel::reload()
 
     clearExpiredTracks();
     clearExpiredContexts(trackFrom, trackTo);
+    m_measureFragmentsByPart.clear();
 
     for (auto& pair : m_playbackDataMap) {
         pair.second.originEvents.clear();
@@ -376,12 +433,89 @@ void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
     ctx->update(trackId.partId, m_score, m_expandRepeats);
 
     PlaybackData& trackData = m_playbackDataMap[trackId];
-    trackData.dynamics = ctx->dynamicLevelLayers(m_score);
+    DynamicLevelLayers dynamics = ctx->dynamicLevelLayers(m_score);
+
+    //! NOTE: Notes only read the dynamic level at or before their own position,
+    //! so fragments ending before the first changed dynamic stay valid
+    removeMeasureFragments(trackId.partId, firstDifferentTimestamp(trackData.dynamics, dynamics));
+
+    trackData.dynamics = std::move(dynamics);
     trackData.params = ctx->playbackParamLayers(m_score);
 }
 
+void PlaybackModel::processMeasure(const int tickPositionOffset, const Measure* measure,
+                                   const std::map<ID, std::set<staff_idx_t> >& staffIdxSetByPart, ChangedTrackIdSet* trackChanges)
+{
+    const int measureStartTick = measure->tick().ticks();
+    const int measureEndTick = measure->endTick().ticks();
+    const timestamp_t timestampFrom = timestampFromTicks(m_score, measureStartTick + tickPositionOffset);
+    const timestamp_t timestampTo = timestampFromTicks(m_score, measureEndTick + tickPositionOffset);
+    const MeasureFragmentKey key { measure, tickPositionOffset };
+
+    std::set<staff_idx_t> staffToRenderIdxSet;
+    std::vector<ID> partsToRender;
+
+    for (const auto& pair : staffIdxSetByPart) {
+        MeasureFragmentMap& fragments = m_measureFragmentsByPart[pair.first];
+        auto search = fragments.find(key);
+
+        if (search != fragments.end()) {
+            const MeasureFragment& fragment = search->second;
+
+            if (fragment.measureStartTick == measureStartTick && fragment.measureEndTick == measureEndTick
+                && fragment.timestampFrom == timestampFrom && fragment.timestampTo == timestampTo) {
+                for (const auto& trackEvents : fragment.events) {
+                    appendEvents(trackEvents.second, m_playbackDataMap[trackEvents.first].originEvents);
+                    collectChangesTracks(trackEvents.first, trackChanges);
+                }
+
+                continue;
+            }
+        }
+
+        staffToRenderIdxSet.insert(pair.second.cbegin(), pair.second.cend());
+        partsToRender.push_back(pair.first);
+    }
+
+    if (partsToRender.empty()) {
+        return;
+    }
+
+    TrackEventsMap renderedEvents;
+    int chordRestSegmentNum = -1;
+
+    for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+        if (!segment->isChordRestType() && !segment->isTimeTickType()) {
+            continue;
+        }
+
+        if (segment->isChordRestType()) {
+            chordRestSegmentNum++;
+        }
+
+        processSegment(tickPositionOffset, segment, staffToRenderIdxSet, chordRestSegmentNum == 0, trackChanges, &renderedEvents);
+    }
+
+    for (const ID& partId : partsToRender) {
+        m_measureFragmentsByPart[partId][key] = MeasureFragment { measureStartTick, measureEndTick, timestampFrom, timestampTo,
+                                                                  timestampTo, {} };
+    }
+
+    for (auto& pair : renderedEvents) {
+        appendEvents(pair.second, m_playbackDataMap[pair.first].originEvents);
+
+        MeasureFragment& fragment = m_measureFragmentsByPart[pair.first.partId][key];
+        if (!pair.second.empty()) {
+            fragment.lastEventTimestamp = std::max(fragment.lastEventTimestamp, pair.second.crbegin()->first);
+        }
+
+        fragment.events.emplace(pair.first, std::move(pair.second));
+    }
+}
+
 void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                                   bool isFirstChordRestSegmentOfMeasure, ChangedTrackIdSet* trackChanges)
+                                   bool isFirstChordRestSegmentOfMeasure, ChangedTrackIdSet* trackChanges,
+                                   TrackEventsMap* fragmentEvents)
 {
     for (const EngravingItem* item : segment->annotations()) {
         if (!item || !item->part()) {
@@ -408,7 +542,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
 
         if (chordSymbol->play()) {
             m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile,
-                                         m_playbackDataMap[trackId].originEvents);
+                                         eventsDestination(trackId, fragmentEvents));
         }
 
         collectChangesTracks(trackId, trackChanges);
@@ -461,7 +595,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
         }
 
         const PlaybackContextPtr ctx = playbackCtx(trackId);
-        m_renderer.render(item, tickPositionOffset, std::move(profile), ctx, m_playbackDataMap[trackId].originEvents);
+        m_renderer.render(item, tickPositionOffset, std::move(profile), ctx, eventsDestination(trackId, fragmentEvents));
 
         collectChangesTracks(trackId, trackChanges);
     }
@@ -513,6 +647,17 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
         return staff.isPrimaryStaff(); // skip linked staves
     });
 
+    std::map<ID, std::set<staff_idx_t> > staffIdxSetByPart;
+    for (const staff_idx_t staffIdx : staffToProcessIdxSet) {
+        const Staff* staff = m_score->staff(staffIdx);
+        if (staff && staff->part()) {
+            staffIdxSetByPart[staff->part()->id()].insert(staffIdx);
+        }
+    }
+
+    const staff_idx_t staffIdxFrom = staffToProcessIdxSet.empty() ? 0 : *staffToProcessIdxSet.cbegin();
+    const staff_idx_t staffIdxTo = staffToProcessIdxSet.empty() ? 0 : *staffToProcessIdxSet.crbegin();
+
     const ArticulationsProfilePtr metronomeProfile = defaultActiculationProfile(METRONOME_TRACK_ID);
     PlaybackEventsMap& metronomeEvents = m_playbackDataMap[METRONOME_TRACK_ID].originEvents;
 
@@ -533,25 +678,34 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                 continue;
             }
 
-            int chordRestSegmentNum = -1;
+            //! NOTE: Measures entirely inside the range are rendered as cacheable fragments.
+            //! Measure repeats refer to other measures, so they are always rendered directly
+            bool isWholeMeasureInRange = measureStartTick >= tickFrom && measureEndTick <= tickTo;
 
-            for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
-                if (!segment->isChordRestType() && !segment->isTimeTickType()) {
-                    continue;
-                }
+            if (isWholeMeasureInRange && !staffToProcessIdxSet.empty()
+                && !measure->containsMeasureRepeat(staffIdxFrom, staffIdxTo)) {
+                processMeasure(tickPositionOffset, measure, staffIdxSetByPart, trackChanges);
+            } else {
+                int chordRestSegmentNum = -1;
 
-                int segmentStartTick = segment->tick().ticks();
-                int segmentEndTick = segmentStartTick + segment->ticks().ticks();
+                for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+                    if (!segment->isChordRestType() && !segment->isTimeTickType()) {
+                        continue;
+                    }
 
-                if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
-                    continue;
-                }
+                    int segmentStartTick = segment->tick().ticks();
+                    int segmentEndTick = segmentStartTick + segment->ticks().ticks();
 
-                if (segment->isChordRestType()) {
-                    chordRestSegmentNum++;
-                }
+                    if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
+                        continue;
+                    }
 
-                processSegment(tickPositionOffset, segment, staffToProcessIdxSet, chordRestSegmentNum == 0, trackChanges);
+                    if (segment->isChordRestType()) {
+                        chordRestSegmentNum++;
+                    }
+
+                    processSegment(tickPositionOffset, segment, staffToProcessIdxSet, chordRestSegmentNum == 0, trackChanges);
+                }
             }
 
             if (m_metronomeEnabled) {
@@ -682,6 +836,30 @@ bool PlaybackModel::hasToReloadScore(const ScoreChangesRange& changesRange) cons
     return false;
 }
 
+bool PlaybackModel::hasToDropMeasureFragments(const ScoreChangesRange& changesRange) const
+{
+    //! NOTE: Changes of these types alter the playback context of the whole part,
+    //! so events rendered for any of its measures may be affected.
+    //! Dynamics are not listed: they are compared in updateContext instead
+    static const std::unordered_set<ElementType> CONTEXT_TYPES = {
+        ElementType::PLAYTECH_ANNOTATION,
+        ElementType::CAPO,
+        ElementType::STAFF_TEXT,
+        ElementType::SOUND_FLAG,
+        ElementType::GUITAR_BEND,
+        ElementType::GUITAR_BEND_SEGMENT,
+        ElementType::BREATH,
+    };
+
+    for (const ElementType type : CONTEXT_TYPES) {
+        if (changesRange.changedTypes.find(type) != changesRange.changedTypes.cend()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool PlaybackModel::containsTrack(const InstrumentTrackId& trackId) const
 {
     return m_playbackDataMap.find(trackId) != m_playbackDataMap.cend();
@@ -719,6 +897,15 @@ void PlaybackModel::clearExpiredTracks()
 
         ++it;
     }
+
+    for (auto fragmentsIt = m_measureFragmentsByPart.begin(); fragmentsIt != m_measureFragmentsByPart.end();) {
+        if (!m_score->partById(fragmentsIt->first.toUint64())) {
+            fragmentsIt = m_measureFragmentsByPart.erase(fragmentsIt);
+            continue;
+        }
+
+        ++fragmentsIt;
+    }
 }
 
 void PlaybackModel::clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo)
@@ -800,6 +987,65 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
     }
 }
 
+void PlaybackModel::invalidateMeasureFragments(const ScoreChangesRange& changesRange, const TrackBoundaries& trackRange)
+{
+    if (!changesRange.isValidBoundary() || hasToReloadScore(changesRange) || !changesRange.changedStyleIdSet.empty()) {
+        m_measureFragmentsByPart.clear();
+        return;
+    }
+
+    const bool dropAll = hasToDropMeasureFragments(changesRange);
+    const TickBoundaries changedTickRange = changedTickBoundaries(changesRange);
+
+    for (const Part* part : m_score->parts()) {
+        if (part->startTrack() > trackRange.trackTo || part->endTrack() <= trackRange.trackFrom) {
+            continue;
+        }
+
+        auto search = m_measureFragmentsByPart.find(part->id());
+        if (search == m_measureFragmentsByPart.end()) {
+            continue;
+        }
+
+        if (dropAll) {
+            m_measureFragmentsByPart.erase(search);
+            continue;
+        }
+
+        MeasureFragmentMap& fragments = search->second;
+
+        for (auto it = fragments.begin(); it != fragments.end();) {
+            const MeasureFragment& fragment = it->second;
+
+            if (fragment.measureStartTick <= changedTickRange.tickTo && fragment.measureEndTick > changedTickRange.tickFrom) {
+                it = fragments.erase(it);
+                continue;
+            }
+
+            ++it;
+        }
+    }
+}
+
+void PlaybackModel::removeMeasureFragments(const ID& partId, const timestamp_t timestampFrom)
+{
+    auto search = m_measureFragmentsByPart.find(partId);
+    if (search == m_measureFragmentsByPart.end()) {
+        return;
+    }
+
+    MeasureFragmentMap& fragments = search->second;
+
+    for (auto it = fragments.begin(); it != fragments.end();) {
+        if (it->second.lastEventTimestamp >= timestampFrom) {
+            it = fragments.erase(it);
+            continue;
+        }
+
+        ++it;
+    }
+}
+
 void PlaybackModel::collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result)
 {
     if (!result) {
@@ -886,21 +1132,28 @@ PlaybackModel::TrackBoundaries PlaybackModel::trackBoundaries(const ScoreChanges
 
 PlaybackModel::TickBoundaries PlaybackModel::tickBoundaries(const ScoreChangesRange& changesRange) const
 {
-    TickBoundaries result;
-
-    result.tickFrom = changesRange.tickFrom;
-    result.tickTo = changesRange.tickTo;
-
     if (hasToReloadTracks(changesRange)
         || hasToReloadScore(changesRange)
         || !changesRange.isValidBoundary()) {
         const Measure* lastMeasure = m_score->lastMeasure();
+
+        TickBoundaries result;
         result.tickFrom = 0;
         result.tickTo = lastMeasure ? lastMeasure->endTick().ticks() : 0;
 
         return result;
     }
 
+    return changedTickBoundaries(changesRange);
+}
+
+PlaybackModel::TickBoundaries PlaybackModel::changedTickBoundaries(const ScoreChangesRange& changesRange) const
+{
+    TickBoundaries result;
+
+    result.tickFrom = changesRange.tickFrom;
+    result.tickTo = changesRange.tickTo;
+
     for (const auto& pair : changesRange.changedItems) {
         const EngravingItem* item = pair.first;
 
@@ -1018,6 +1271,15 @@ muse::mpe::ArticulationsProfilePtr PlaybackModel::defaultActiculationProfile(con
     return profilesRepository()->defaultProfile(it->second.setupData.category);
 }
 
+PlaybackEventsMap& PlaybackModel::eventsDestination(const InstrumentTrackId& trackId, TrackEventsMap* fragmentEvents)
+{
+    if (fragmentEvents) {
+        return (*fragmentEvents)[trackId];
+    }
+
+    return m_playbackDataMap[trackId].originEvents;
+}
+
 PlaybackContextPtr PlaybackModel::playbackCtx(const InstrumentTrackId& trackId)
 {
     auto it = m_playbackCtxMap.find(trackId);
@@ -26,6 +26,8 @@
 #include <unordered_map>
 #include <map>
 #include <functional>
+#include <set>
+#include <tuple>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
@@ -45,6 +47,7 @@ class Score;
 class Note;
 class EngravingItem;
 class Segment;
+class Measure;
 class Instrument;
 class RepeatList;
 
@@ -106,6 +109,33 @@ private:
         track_idx_t trackTo = muse::nidx;
     };
 
+    using TrackEventsMap = std::unordered_map<InstrumentTrackId, muse::mpe::PlaybackEventsMap>;
+
+    struct MeasureFragmentKey
+    {
+        const Measure* measure = nullptr;
+        int tickPositionOffset = 0;
+
+        bool operator<(const MeasureFragmentKey& other) const
+        {
+            return std::tie(measure, tickPositionOffset) < std::tie(other.measure, other.tickPositionOffset);
+        }
+    };
+
+    //! NOTE: Events of one part rendered for one measure of one repeat pass.
+    //! Reused until the measure, or anything the part's playback context depends on, changes
+    struct MeasureFragment
+    {
+        int measureStartTick = 0;
+        int measureEndTick = 0;
+        muse::mpe::timestamp_t timestampFrom = 0;
+        muse::mpe::timestamp_t timestampTo = 0;
+        muse::mpe::timestamp_t lastEventTimestamp = 0;
+        TrackEventsMap events;
+    };
+
+    using MeasureFragmentMap = std::map<MeasureFragmentKey, MeasureFragment>;
+
     InstrumentTrackId idKey(const EngravingItem* item) const;
     InstrumentTrackId idKey(const std::vector<const EngravingItem*>& items) const;
     InstrumentTrackId idKey(const ID& partId, const String& instrumentId) const;
@@ -120,18 +150,23 @@ private:
 
     void reloadMetronomeEvents();
 
+    void processMeasure(const int tickPositionOffset, const Measure* measure, const std::map<ID, std::set<staff_idx_t> >& staffIdxSetByPart,
+                        ChangedTrackIdSet* trackChanges);
     void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                        bool isFirstChordRestSegmentOfMeasure, ChangedTrackIdSet* trackChanges);
+                        bool isFirstChordRestSegmentOfMeasure, ChangedTrackIdSet* trackChanges, TrackEventsMap* fragmentEvents = nullptr);
     void processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
                               const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges);
 
     bool hasToReloadTracks(const ScoreChangesRange& changesRange) const;
     bool hasToReloadScore(const ScoreChangesRange& changesRange) const;
+    bool hasToDropMeasureFragments(const ScoreChangesRange& changesRange) const;
 
     bool containsTrack(const InstrumentTrackId& trackId) const;
     void clearExpiredTracks();
     void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo);
     void clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo);
+    void invalidateMeasureFragments(const ScoreChangesRange& changesRange, const TrackBoundaries& trackRange);
+    void removeMeasureFragments(const ID& partId, const muse::mpe::timestamp_t timestampFrom);
     void collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result);
     void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks);
 
@@ -142,6 +177,7 @@ private:
 
     TrackBoundaries trackBoundaries(const ScoreChangesRange& changesRange) const;
     TickBoundaries tickBoundaries(const ScoreChangesRange& changesRange) const;
+    TickBoundaries changedTickBoundaries(const ScoreChangesRange& changesRange) const;
 
     const RepeatList& repeatList() const;
 
@@ -150,6 +186,7 @@ private:
     muse::mpe::ArticulationsProfilePtr defaultActiculationProfile(const InstrumentTrackId& trackId) const;
 
     PlaybackContextPtr playbackCtx(const InstrumentTrackId& trackId);
+    muse::mpe::PlaybackEventsMap& eventsDestination(const InstrumentTrackId& trackId, TrackEventsMap* fragmentEvents);
 
     static void applyTiedNotesTickBoundaries(const Note* note, TickBoundaries& tickBoundaries);
     static void applyTieTickBoundaries(const Tie* tie, TickBoundaries& tickBoundaries);
@@ -164,6 +201,7 @@ private:
 
     std::unordered_map<InstrumentTrackId, PlaybackContextPtr> m_playbackCtxMap;
     std::unordered_map<InstrumentTrackId, muse::mpe::PlaybackData> m_playbackDataMap;
+    std::map<ID /*partId*/, MeasureFragmentMap> m_measureFragmentsByPart;
 
     muse::async::Notification m_dataChanged;
     muse::async::Channel<InstrumentTrackId> m_trackAdded;
@@ -109,6 +109,7 @@ public:
         bool isPrinting = false;
         bool isMultiPage = false;
         bool printPageBackground = true;
+        bool isRecordPages = false; // keep the printed pages as display lists, for callers that paint them repeatedly
         RectF frameRect;
         int fromPage = -1; // 0 is first
         int toPage = -1;
@@ -42,6 +42,12 @@ struct LayoutOptions
     bool isShowVBox = true;
     double noteHeadWidth = 0.0;
 
+    // Per-staff work that doesn't depend on other staves (e.g. skyline
+    // construction) is distributed over a worker pool once system breaks are fixed.
+    // Output is identical to single-threaded layout. New scores take the value
+    // of MScore::parallelLayout, which the command line converter turns on.
+    bool isParallelLayout = false;
+
     bool isMode(LayoutMode m) const { return mode == m; }
     bool isLinearMode() const { return mode == LayoutMode::LINE || mode == LayoutMode::HORIZONTAL_FIXED; }
 };
@@ -104,6 +104,7 @@ public:
 
     bool isShowVBox() const { return options().isShowVBox; }
     double noteHeadWidth() const { return options().noteHeadWidth; }
+    bool isParallelLayout() const { return options().isParallelLayout; }
     bool isShowInvisible() const;
     int pageNumberOffset() const;
     bool isVerticalSpreadEnabled() const;
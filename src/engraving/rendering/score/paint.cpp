@@ -22,6 +22,8 @@
 #include "paint.h"
 
 #include "draw/painter.h"
+#include "draw/displaylistpaintprovider.h"
+#include "draw/utils/displaylistpaint.h"
 #include "dom/score.h"
 #include "dom/page.h"
 #include "dom/engravingitem.h"
@@ -67,14 +69,23 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Pai
     }
 
     // Setup score draw system
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / DEVICE_DPI;
+    //! NOTE The globals are only written when they change, so that the parts of a score
+    //! can be painted from several threads at once with the same settings (see ConverterController)
+    const double pixelRatio = mu::engraving::DPI / DEVICE_DPI;
+    if (!muse::RealIsEqual(mu::engraving::MScore::pixelRatio, pixelRatio)) {
+        mu::engraving::MScore::pixelRatio = pixelRatio;
+    }
     score->setPrinting(opt.isPrinting);
-    mu::engraving::MScore::pdfPrinting = opt.isPrinting;
+    if (mu::engraving::MScore::pdfPrinting != opt.isPrinting) {
+        mu::engraving::MScore::pdfPrinting = opt.isPrinting;
+    }
 
     // Setup page counts
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
     int toPage = (opt.toPage >= 0 && opt.toPage < int(pages.size())) ? opt.toPage : (int(pages.size()) - 1);
 
+    std::vector<EngravingItem*> elements;
+
     for (int copy = 0; copy < opt.copyCount; ++copy) {
         bool firstPage = true;
         for (int pi = fromPage; pi <= toPage; ++pi) {
@@ -144,8 +155,19 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Pai
                 disableClipping = true;
             }
 
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintItems(*painter, elements);
+            elements.clear();
+
+            //! NOTE When printing whole pages, the page doesn't depend on the state of the view (selection, invisible items, etc.),
+            //! so callers painting it repeatedly (converter, video export) record it once and replay it
+            //! while the page isn't laid out again. One-off exports only replay an existing recording,
+            //! so they don't leave display lists on the pages
+            const bool isWholePagePrinting = opt.isPrinting && !opt.frameRect.isValid() && opt.trimMarginPixelSize < 0;
+            if (isWholePagePrinting && (opt.isRecordPages || isPaintCacheValid(page, DEVICE_DPI))) {
+                paintPageCached(*painter, page, DEVICE_DPI);
+            } else {
+                page->items(drawRect.translated(-pagePos), elements);
+                paintItems(*painter, elements);
+            }
             //DebugPaint::paintPageTree(*painter, page);
 
             if (disableClipping) {
@@ -229,6 +251,40 @@ void Paint::paintItem(Painter& painter, const EngravingItem* item)
     painter.translate(-itemPosition);
 }
 
+bool Paint::isPaintCacheValid(const Page* page, int deviceDpi)
+{
+    const Page::PaintCache& cache = page->paintCache();
+    return cache.displayList && cache.deviceDpi == deviceDpi && cache.pageCount == page->score()->npages();
+}
+
+void Paint::paintPageCached(Painter& painter, Page* page, int deviceDpi)
+{
+    TRACEFUNC;
+
+    if (!isPaintCacheValid(page, deviceDpi)) {
+        const size_t pageCount = page->score()->npages();
+        auto recorder = std::make_shared<DisplayListPaintProvider>();
+
+        {
+            Painter recordingPainter(recorder, "page_" + std::to_string(page->no()));
+            recordingPainter.setAntialiasing(true);
+            recordingPainter.setPen(painter.pen());
+            recordingPainter.setBrush(painter.brush());
+            recordingPainter.setFont(painter.font());
+
+            paintItems(recordingPainter, page->items(page->ldata()->bbox()));
+        }
+
+        Page::PaintCache newCache;
+        newCache.displayList = recorder->displayList();
+        newCache.deviceDpi = deviceDpi;
+        newCache.pageCount = pageCount;
+        page->setPaintCache(newCache);
+    }
+
+    DisplayListPaint::paint(&painter, *page->paintCache().displayList);
+}
+
 void Paint::paintItems(Painter& painter, const std::vector<EngravingItem*>& items)
 {
     TRACEFUNC;
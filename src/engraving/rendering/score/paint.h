@@ -46,6 +46,8 @@ public:
     static SizeF pageSizeInch(const Score* score, const IScoreRenderer::PaintOptions& opt);
 
 private:
+    static bool isPaintCacheValid(const Page* page, int deviceDpi);
+    static void paintPageCached(muse::draw::Painter& painter, Page* page, int deviceDpi);
 };
 }
 
@@ -150,6 +150,7 @@ private:
 
     static System* getNextSystem(LayoutContext& lc);
     static void createSkylines(const ElementsToLayout& elementsToLayout, LayoutContext& ctx);
+    static void createSkyline(const ElementsToLayout& elementsToLayout, staff_idx_t staffIdx);
     static void processLines(System* system, LayoutContext& ctx, const std::vector<Spanner*>& lines, bool align = false);
     static void layoutTies(Chord* ch, System* system, const Fraction& stick, LayoutContext& ctx);
     static void doLayoutTies(System* system, const std::vector<Segment*>& sl, const Fraction& stick, const Fraction& etick,
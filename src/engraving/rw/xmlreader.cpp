@@ -22,6 +22,8 @@
 
 #include "xmlreader.h"
 
+#include <cstdlib>
+
 #include "log.h"
 
 using namespace mu;
@@ -125,9 +127,17 @@ Fraction XmlReader::readFraction()
         if (i == muse::nidx) {
             return Fraction::fromTicks(s.toInt());
         } else {
-            String str = String::fromAscii(s.ascii());
-            z = str.left(i).toInt();
-            n = str.mid(i + 1).toInt();
+            // parse both parts in place, the same way as String::toInt() would do on the substrings
+            const char* str = s.ascii();
+            char* end = nullptr;
+            z = static_cast<int>(std::strtol(str, &end, 10));
+            if (end != str + i) {
+                z = 0;
+            }
+            n = static_cast<int>(std::strtol(str + i + 1, &end, 10));
+            if (*end != '\0') {
+                n = 0;
+            }
         }
     }
     return Fraction(z, n);
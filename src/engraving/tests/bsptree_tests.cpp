@@ -86,3 +86,49 @@ TEST_F(Engraving_BspTreeTests, NearestNeighbor)
         EXPECT_EQ(nn, singleNote);
     }
 }
+
+/**
+ * @brief Engraving_BspTreeTests_ItemsInRect
+ * @details Check that BspTree::items finds inserted items and no longer returns them once removed
+ */
+TEST_F(Engraving_BspTreeTests, ItemsInRect)
+{
+    Score* score = ScoreRW::readScore(BSPTREE_DATA_DIR + u"nearest_neighbor.mscx");
+    EXPECT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    EXPECT_TRUE(page);
+
+    // [GIVEN] A BspTree containing all notes of the page
+    BspTree bsp;
+    std::vector<EngravingItem*> notes;
+    bsp.initialize(page->pageBoundingRect(), static_cast<int>(page->elements().size()));
+    for (EngravingItem* elem : page->elements()) {
+        if (elem->isNote()) {
+            notes.push_back(elem);
+            bsp.insert(elem);
+        }
+    }
+
+    EXPECT_FALSE(notes.empty());
+
+    // [WHEN] Querying the bounding rect of each note
+    std::vector<EngravingItem*> found;
+    for (EngravingItem* note : notes) {
+        bsp.items(note->pageBoundingRect(), found);
+        // [THEN] The note is found, and only items intersecting the rect are returned
+        EXPECT_TRUE(muse::contains(found, note));
+        for (EngravingItem* item : found) {
+            EXPECT_TRUE(item->pageBoundingRect().intersects(note->pageBoundingRect()));
+        }
+    }
+
+    // [WHEN] Removing a note and querying its rect again
+    EngravingItem* removed = notes.front();
+    bsp.remove(removed);
+    bsp.items(removed->pageBoundingRect(), found);
+
+    // [THEN] The removed note is not returned anymore
+    EXPECT_FALSE(muse::contains(found, removed));
+    EXPECT_EQ(bsp.items(removed->pageBoundingRect()), found);
+}
@@ -164,3 +164,56 @@ TEST_F(Engraving_LayoutElementsTests, tstLayoutCrossStaffArp)
 
     delete score;
 }
+
+//---------------------------------------------------------
+//   layoutSnapshot
+//    The skylines and the staff positions of all systems,
+//    which is what parallel layout computes concurrently
+//---------------------------------------------------------
+
+struct LayoutSnapshot {
+    std::vector<RectF> rects;
+    std::vector<const EngravingItem*> items;
+    std::vector<double> staffYs;
+};
+
+static LayoutSnapshot layoutSnapshot(const Score* score)
+{
+    LayoutSnapshot snapshot;
+    for (const System* system : score->systems()) {
+        for (const SysStaff* staff : system->staves()) {
+            snapshot.staffYs.push_back(staff->y());
+            for (const SkylineLine* line : { &staff->skyline().north(), &staff->skyline().south() }) {
+                for (const ShapeElement& element : line->elements()) {
+                    snapshot.rects.push_back(element);
+                    snapshot.items.push_back(element.item());
+                }
+            }
+        }
+    }
+    return snapshot;
+}
+
+TEST_F(Engraving_LayoutElementsTests, tstParallelLayoutMatchesSequential)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "layout_elements.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_GT(score->nstaves(), 1);
+
+    score->setParallelLayout(false);
+    score->update();
+    score->doLayout();
+    const LayoutSnapshot sequential = layoutSnapshot(score);
+
+    score->setParallelLayout(true);
+    score->update();
+    score->doLayout();
+    const LayoutSnapshot parallel = layoutSnapshot(score);
+
+    EXPECT_FALSE(sequential.rects.empty());
+    EXPECT_EQ(parallel.rects, sequential.rects);
+    EXPECT_EQ(parallel.items, sequential.items);
+    EXPECT_EQ(parallel.staffYs, sequential.staffYs);
+
+    delete score;
+}
@@ -874,6 +874,62 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     score->changesChannel().send(range);
 }
 
+/**
+ * @brief PlaybackModelTests_SimpleRepeat_Changes_Reuse_Measures
+ * @details Changes which require reloading the whole track, but don't affect the notes,
+ *          must produce the same events as the initial load
+ */
+TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Reuse_Measures)
+{
+    // [GIVEN] Simple piece of score (Violin, 4/4, 120 bpm, Treble Cleff)
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "repeat_range/repeat_range.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+    ASSERT_TRUE(part);
+
+    // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
+    ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
+
+    // [GIVEN] The playback model requested to be loaded
+    PlaybackModel model(modularity::globalCtx());
+    model.profilesRepository.set(m_repositoryMock);
+    model.load(score);
+
+    PlaybackData result = model.resolveTrackPlaybackData(part->id(), part->instrumentId());
+    const PlaybackEventsMap expectedEvents = result.originEvents;
+    ASSERT_FALSE(expectedEvents.empty());
+
+    int receivedChangesCount = 0;
+
+    // [THEN] Updated events map will match the initial one
+    result.mainStream.onReceive(this, [&expectedEvents, &receivedChangesCount](const PlaybackEventsMap& updatedEvents,
+                                                                               const DynamicLevelLayers&,
+                                                                               const PlaybackParamLayers&) {
+        EXPECT_EQ(updatedEvents, expectedEvents);
+        ++receivedChangesCount;
+    });
+
+    // [WHEN] A chord symbol has been changed inside the repeat
+    ScoreChangesRange range;
+    range.tickFrom = 3840;
+    range.tickTo = 4800;
+    range.staffIdxFrom = 0;
+    range.staffIdxTo = 0;
+    range.changedTypes = { ElementType::HARMONY };
+
+    score->changesChannel().send(range);
+
+    // [WHEN] A dynamic has been changed without changing the dynamic levels
+    range.changedTypes = { ElementType::DYNAMIC };
+
+    score->changesChannel().send(range);
+
+    EXPECT_EQ(receivedChangesCount, 2);
+}
+
 /**
  * @brief PlaybackModelTests_TempoChangesDuringNotes
  * @details Test that notes and other elements have the correct length when tempo changes occur during them
@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cfloat>
+#include <random>
+
+#include "infrastructure/shape.h"
+
+using namespace mu::engraving;
+
+class Engraving_ShapeTests : public ::testing::Test
+{
+};
+
+//! NOTE Straightforward pairwise implementations, used as reference for the packed kernels
+static double referenceMinVerticalDistance(const Shape& top, const Shape& bottom, double minHorizontalClearance)
+{
+    if (top.empty() || bottom.empty()) {
+        return 0.0;
+    }
+
+    double dist = -DBL_MAX;
+    for (const ShapeElement& r2 : bottom.elements()) {
+        for (const ShapeElement& r1 : top.elements()) {
+            if (r1.height() <= 0.0 || r2.height() <= 0.0) {
+                continue;
+            }
+            if (intersects(r1.left(), r1.right(), r2.left(), r2.right(), minHorizontalClearance)) {
+                dist = std::max(dist, r1.bottom() - r2.top());
+            }
+        }
+    }
+    return dist;
+}
+
+static double referenceVerticalClearance(const Shape& top, const Shape& bottom, double minHorizontalDistance)
+{
+    if (top.empty() || bottom.empty()) {
+        return 0.0;
+    }
+
+    double dist = DBL_MAX;
+    for (const ShapeElement& r2 : bottom.elements()) {
+        for (const ShapeElement& r1 : top.elements()) {
+            if (r1.height() <= 0.0 || r2.height() <= 0.0) {
+                continue;
+            }
+            if (intersects(r1.left(), r1.right(), r2.left(), r2.right(), minHorizontalDistance)) {
+                dist = std::min(dist, r2.top() - r1.bottom());
+            }
+        }
+    }
+    return dist;
+}
+
+static Shape randomShape(std::mt19937& gen, size_t count, double yOffset)
+{
+    std::uniform_real_distribution<double> pos(0.0, 100.0);
+    std::uniform_real_distribution<double> size(0.0, 10.0);
+    std::uniform_int_distribution<int> special(0, 9);
+
+    Shape shape;
+    for (size_t i = 0; i < count; ++i) {
+        double x = pos(gen);
+        double w = size(gen);
+        double h = size(gen);
+        switch (special(gen)) {
+        case 0: w = 0.0; // zero width
+            break;
+        case 1: h = 0.0; // zero height
+            break;
+        case 2: h = -h; // negative height
+            break;
+        default:
+            break;
+        }
+        shape.add(RectF(x, yOffset + pos(gen) * 0.2, w, h));
+    }
+    return shape;
+}
+
+/**
+ * @brief Engraving_ShapeTests_VerticalDistance
+ * @details Checks that Shape::minVerticalDistance and Shape::verticalClearance give exactly the same
+ *          results as the straightforward pairwise computation
+ */
+TEST_F(Engraving_ShapeTests, VerticalDistance)
+{
+    std::mt19937 gen(42);
+
+    for (size_t topCount : { 0, 1, 3, 17, 64 }) {
+        for (size_t bottomCount : { 0, 1, 5, 33 }) {
+            for (double clearance : { 0.0, 0.5, 2.0 }) {
+                // [GIVEN] Two shapes, one located below the other
+                Shape top = randomShape(gen, topCount, 0.0);
+                Shape bottom = randomShape(gen, bottomCount, 15.0);
+
+                // [THEN] The results match the reference implementation
+                EXPECT_EQ(top.minVerticalDistance(bottom, clearance), referenceMinVerticalDistance(top, bottom, clearance));
+                EXPECT_EQ(top.verticalClearance(bottom, clearance), referenceVerticalClearance(top, bottom, clearance));
+            }
+        }
+    }
+}
@@ -101,6 +101,10 @@ public:
 
     constexpr void reduce()
     {
+        if (m_denominator == 1) {
+            return;
+        }
+
         const int64_t g = std::gcd(m_numerator, m_denominator);
         if (g) {
             m_numerator /= g;
@@ -156,6 +160,13 @@ public:
         if (m_denominator == val.m_denominator) {
             // Common enough use case to be handled separately for efficiency
             m_numerator += val.m_numerator;
+        } else if (m_denominator != 0 && val.m_denominator % m_denominator == 0) {
+            // One denominator divides the other (e.g. whole ticks and durations, or powers of two):
+            // the same result as below, just without the gcd
+            m_numerator = m_numerator * (val.m_denominator / m_denominator) + val.m_numerator;
+            m_denominator = val.m_denominator;
+        } else if (val.m_denominator != 0 && m_denominator % val.m_denominator == 0) {
+            m_numerator += val.m_numerator * (m_denominator / val.m_denominator);
         } else {
             const int64_t g = std::gcd(m_denominator, val.m_denominator);
             if (g) {
@@ -172,6 +183,13 @@ public:
         if (m_denominator == val.m_denominator) {
             // Common enough use case to be handled separately for efficiency
             m_numerator -= val.m_numerator;
+        } else if (m_denominator != 0 && val.m_denominator % m_denominator == 0) {
+            // One denominator divides the other (e.g. whole ticks and durations, or powers of two):
+            // the same result as below, just without the gcd
+            m_numerator = m_numerator * (val.m_denominator / m_denominator) - val.m_numerator;
+            m_denominator = val.m_denominator;
+        } else if (val.m_denominator != 0 && m_denominator % val.m_denominator == 0) {
+            m_numerator -= val.m_numerator * (m_denominator / val.m_denominator);
         } else {
             const int64_t g = std::gcd(m_denominator, val.m_denominator);
             if (g) {
@@ -23,8 +23,10 @@
 #ifndef MUSE_AUDIO_ABSTRACTEVENTSEQUENCER_H
 #define MUSE_AUDIO_ABSTRACTEVENTSEQUENCER_H
 
+#include <algorithm>
 #include <map>
 #include <set>
+#include <vector>
 
 #include "global/async/asyncable.h"
 #include "mpe/events.h"
@@ -33,6 +35,84 @@
 #include "../audiotypes.h"
 
 namespace muse::audio {
+//! NOTE Events sorted by time, stored contiguously.
+//! Events are added in any order, then sort() must be called before reading
+template<class EventT>
+class SortedEventList
+{
+public:
+    struct Item {
+        msecs_t timestamp = 0;
+        EventT event;
+    };
+
+    void add(const msecs_t timestamp, EventT event)
+    {
+        m_items.push_back(Item { timestamp, std::move(event) });
+        m_isSorted = false;
+    }
+
+    void clear()
+    {
+        m_items.clear();
+        m_isSorted = true;
+    }
+
+    bool empty() const
+    {
+        return m_items.empty();
+    }
+
+    size_t size() const
+    {
+        return m_items.size();
+    }
+
+    const Item& at(const size_t idx) const
+    {
+        return m_items[idx];
+    }
+
+    //! NOTE The order and the removal of duplicates is the same as in std::map<msecs_t, std::set<EventT> >
+    void sort()
+    {
+        if (m_isSorted) {
+            return;
+        }
+
+        auto less = [](const Item& a, const Item& b) {
+            if (a.timestamp != b.timestamp) {
+                return a.timestamp < b.timestamp;
+            }
+
+            return a.event < b.event;
+        };
+
+        std::stable_sort(m_items.begin(), m_items.end(), less);
+
+        auto equal = [&less](const Item& a, const Item& b) {
+            return !less(a, b) && !less(b, a);
+        };
+
+        m_items.erase(std::unique(m_items.begin(), m_items.end(), equal), m_items.end());
+        m_isSorted = true;
+    }
+
+    //! NOTE Returns the index of the first event at or after the timestamp
+    size_t lowerBound(const msecs_t timestamp) const
+    {
+        auto it = std::lower_bound(m_items.cbegin(), m_items.cend(), timestamp, [](const Item& item, const msecs_t time) {
+            return item.timestamp < time;
+        });
+
+        return std::distance(m_items.cbegin(), it);
+    }
+
+private:
+    std::vector<Item> m_items;
+    bool m_isSorted = true;
+};
+
 template<class ... Types>
 class AbstractEventSequencer : public async::Asyncable
 {
@@ -40,9 +120,7 @@ public:
     using EventType = std::variant<Types...>;
     using EventSequence = std::set<EventType>;
     using EventSequenceMap = std::map<msecs_t, EventSequence>;
-
-    typedef typename EventSequenceMap::const_iterator SequenceIterator;
-    typedef typename EventSequence::const_iterator EventIterator;
+    using EventList = SortedEventList<EventType>;
 
     virtual ~AbstractEventSequencer()
     {
@@ -174,7 +252,7 @@ public:
         if (!m_isActive) {
             result.emplace(m_offstreamPosition, EventSequence());
 
-            if (m_currentOffSequenceIt == m_offStreamEvents.cend()) {
+            if (m_currentOffSequenceIdx >= m_offStreamEvents.size()) {
                 return result;
             }
 
@@ -188,7 +266,7 @@ public:
         result.emplace(m_playbackPosition, EventSequence());
         m_playbackPosition += nextMsecs;
 
-        if (m_currentMainSequenceIt == m_mainStreamEvents.cend()) {
+        if (m_currentMainSequenceIdx >= m_mainStreamEvents.size()) {
             return result;
         }
 
@@ -212,18 +290,21 @@ protected:
 
     void updateMainSequenceIterator()
     {
-        m_currentMainSequenceIt = m_mainStreamEvents.lower_bound(m_playbackPosition);
+        m_mainStreamEvents.sort();
+        m_currentMainSequenceIdx = m_mainStreamEvents.lowerBound(m_playbackPosition);
     }
 
     void updateOffSequenceIterator()
     {
-        m_currentOffSequenceIt = m_offStreamEvents.cbegin();
+        m_offStreamEvents.sort();
+        m_currentOffSequenceIdx = 0;
         m_offstreamPosition = 0;
     }
 
     void updateDynamicChangesIterator()
     {
-        m_currentDynamicsIt = m_dynamicEvents.lower_bound(m_playbackPosition);
+        m_dynamicEvents.sort();
+        m_currentDynamicsIdx = m_dynamicEvents.lowerBound(m_playbackPosition);
     }
 
     void handleOffStream(EventSequenceMap& result)
@@ -232,15 +313,9 @@ protected:
             return;
         }
 
-        while (m_currentOffSequenceIt != m_offStreamEvents.end()
-               && m_currentOffSequenceIt->first <= m_offstreamPosition) {
-            EventSequence& sequence = result[m_currentOffSequenceIt->first];
-            sequence.insert(m_currentOffSequenceIt->second.cbegin(),
-                            m_currentOffSequenceIt->second.cend());
-            m_currentOffSequenceIt = std::next(m_currentOffSequenceIt);
-        }
+        collectEvents(m_offStreamEvents, m_currentOffSequenceIdx, m_offstreamPosition, result);
 
-        if (m_currentOffSequenceIt == m_offStreamEvents.end()) {
+        if (m_currentOffSequenceIdx >= m_offStreamEvents.size()) {
             m_offStreamEvents.clear();
             updateOffSequenceIterator();
         }
@@ -248,13 +323,7 @@ protected:
 
     void handleMainStream(EventSequenceMap& result)
     {
-        while (m_currentMainSequenceIt != m_mainStreamEvents.end()
-               && m_currentMainSequenceIt->first <= m_playbackPosition) {
-            EventSequence& sequence = result[m_currentMainSequenceIt->first];
-            sequence.insert(m_currentMainSequenceIt->second.cbegin(),
-                            m_currentMainSequenceIt->second.cend());
-            m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
-        }
+        collectEvents(m_mainStreamEvents, m_currentMainSequenceIdx, m_playbackPosition, result);
     }
 
     void handleDynamicChanges(EventSequenceMap& result)
@@ -263,25 +332,37 @@ protected:
             return;
         }
 
-        while (m_currentDynamicsIt != m_dynamicEvents.end()
-               && m_currentDynamicsIt->first <= m_playbackPosition) {
-            EventSequence& sequence = result[m_currentDynamicsIt->first];
-            sequence.insert(m_currentDynamicsIt->second.cbegin(),
-                            m_currentDynamicsIt->second.cend());
-            m_currentDynamicsIt = std::next(m_currentDynamicsIt);
+        collectEvents(m_dynamicEvents, m_currentDynamicsIdx, m_playbackPosition, result);
+    }
+
+    static void collectEvents(const EventList& events, size_t& currentIdx, const msecs_t position, EventSequenceMap& result)
+    {
+        EventSequence* sequence = nullptr;
+        msecs_t sequenceTimestamp = 0;
+
+        while (currentIdx < events.size() && events.at(currentIdx).timestamp <= position) {
+            const typename EventList::Item& item = events.at(currentIdx);
+
+            if (!sequence || item.timestamp != sequenceTimestamp) {
+                sequence = &result[item.timestamp];
+                sequenceTimestamp = item.timestamp;
+            }
+
+            sequence->insert(item.event);
+            ++currentIdx;
         }
     }
 
     mutable msecs_t m_playbackPosition = 0;
     mutable msecs_t m_offstreamPosition = 0;
 
-    SequenceIterator m_currentMainSequenceIt;
-    SequenceIterator m_currentOffSequenceIt;
-    SequenceIterator m_currentDynamicsIt;
+    size_t m_currentMainSequenceIdx = 0;
+    size_t m_currentOffSequenceIdx = 0;
+    size_t m_currentDynamicsIdx = 0;
 
-    EventSequenceMap m_mainStreamEvents;
-    EventSequenceMap m_offStreamEvents;
-    EventSequenceMap m_dynamicEvents;
+    EventList m_mainStreamEvents;
+    EventList m_offStreamEvents;
+    EventList m_dynamicEvents;
 
     mpe::PlaybackData m_playbackData;
 
@@ -21,6 +21,8 @@
  */
 #include "audiosanitizer.h"
 
+#include <cstdlib>
+#include <new>
 #include <thread>
 
 #include "containers.h"
@@ -31,6 +33,8 @@ static std::thread::id s_as_mainThreadID;
 static std::thread::id s_as_workerThreadID;
 static std::set<std::thread::id> s_mixerThreadIdSet;
 
+static thread_local int s_as_noAllocationDepth = 0;
+
 void AudioSanitizer::setupMainThread()
 {
     s_as_mainThreadID = std::this_thread::get_id();
@@ -67,3 +71,108 @@ bool AudioSanitizer::isWorkerThread()
 
     return id == s_as_workerThreadID || muse::contains(s_mixerThreadIdSet, id);
 }
+
+void AudioSanitizer::beginNoAllocation()
+{
+    ++s_as_noAllocationDepth;
+}
+
+void AudioSanitizer::endNoAllocation()
+{
+    assert(s_as_noAllocationDepth > 0);
+    --s_as_noAllocationDepth;
+}
+
+int AudioSanitizer::suspendNoAllocation()
+{
+    int depth = s_as_noAllocationDepth;
+    s_as_noAllocationDepth = 0;
+    return depth;
+}
+
+void AudioSanitizer::resumeNoAllocation(int depth)
+{
+    s_as_noAllocationDepth = depth;
+}
+
+bool AudioSanitizer::isAllocationAllowed()
+{
+    return s_as_noAllocationDepth == 0;
+}
+
+#ifndef NDEBUG
+
+//! NOTE Catch heap allocations in the real-time parts of the audio engine (see NoAllocationScope)
+
+static void* as_allocate(std::size_t size)
+{
+    assert(AudioSanitizer::isAllocationAllowed());
+
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+static void as_deallocate(void* ptr) noexcept
+{
+    assert(!ptr || AudioSanitizer::isAllocationAllowed());
+
+    std::free(ptr);
+}
+
+void* operator new(std::size_t size)
+{
+    return as_allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return as_allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    assert(AudioSanitizer::isAllocationAllowed());
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    assert(AudioSanitizer::isAllocationAllowed());
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    as_deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    as_deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    as_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    as_deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    as_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    as_deallocate(ptr);
+}
+
+#endif
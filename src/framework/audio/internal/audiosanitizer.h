@@ -41,6 +41,31 @@ public:
     static void setMixerThreads(const std::set<std::thread::id>& threadIdSet);
     static std::thread::id workerThread();
     static bool isWorkerThread();
+
+    //! NOTE In debug builds the global operator new/delete assert
+    //! if they are called while allocation is forbidden on the current thread
+    static void beginNoAllocation();
+    static void endNoAllocation();
+    static int suspendNoAllocation();
+    static void resumeNoAllocation(int depth);
+    static bool isAllocationAllowed();
+};
+
+class NoAllocationScope
+{
+public:
+    NoAllocationScope() { AudioSanitizer::beginNoAllocation(); }
+    ~NoAllocationScope() { AudioSanitizer::endNoAllocation(); }
+};
+
+class AllowAllocationScope
+{
+public:
+    AllowAllocationScope() { m_depth = AudioSanitizer::suspendNoAllocation(); }
+    ~AllowAllocationScope() { AudioSanitizer::resumeNoAllocation(m_depth); }
+
+private:
+    int m_depth = 0;
 };
 }
 
@@ -49,4 +74,12 @@ public:
 #define ONLY_AUDIO_MAIN_OR_WORKER_THREAD assert((muse::audio::AudioSanitizer::isWorkerThread() \
                                                  || muse::audio::AudioSanitizer::isMainThread()))
 
+#ifndef NDEBUG
+#define AUDIO_NO_ALLOCATION_SCOPE muse::audio::NoAllocationScope __audioNoAllocationScope
+#define AUDIO_ALLOW_ALLOCATION_SCOPE muse::audio::AllowAllocationScope __audioAllowAllocationScope
+#else
+#define AUDIO_NO_ALLOCATION_SCOPE
+#define AUDIO_ALLOW_ALLOCATION_SCOPE
+#endif
+
 #endif // MUSE_AUDIO_AUDIOSANITIZER_H
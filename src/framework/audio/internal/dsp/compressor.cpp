@@ -22,6 +22,7 @@
 #include "compressor.h"
 
 #include "audiomathutils.h"
+#include "sampleops.h"
 
 #include "log.h"
 
@@ -94,9 +95,7 @@ void Compressor::process(const float linearRms, float* buffer, const audioch_t&
     float currentGainReduction = std::min(gainFact, m_previousGainReduction);
 
     // apply gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, currentGainReduction);
-    }
+    multiplySamples(buffer, currentGainReduction, samplesPerChannel * audioChannelsCount);
 
     m_previousGainReduction = currentGainReduction;
 }
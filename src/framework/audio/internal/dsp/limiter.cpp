@@ -22,6 +22,7 @@
 #include "limiter.h"
 
 #include "audiomathutils.h"
+#include "sampleops.h"
 
 using namespace muse::audio;
 using namespace muse::audio::dsp;
@@ -94,7 +95,5 @@ void Limiter::process(const float& linearRms, float* buffer, const audioch_t& au
     float totalLinearGain = muse::db_to_linear(makeUpGain);
 
     // apply linear gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, totalLinearGain);
-    }
+    multiplySamples(buffer, totalLinearGain, samplesPerChannel * audioChannelsCount);
 }
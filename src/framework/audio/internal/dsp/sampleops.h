@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_AUDIO_SAMPLEOPS_H
+#define MUSE_AUDIO_SAMPLEOPS_H
+
+#include <cstddef>
+
+#include "../fx/reverb/simdtypes.h"
+
+#include "../../audiotypes.h"
+
+//
+// Vectorised kernels for the per-sample math of the mixer and its dynamics processors.
+// The buffers are interleaved and don't need to be aligned: the bulk is processed
+// with 4-wide simd types, the remainder with plain scalar code.
+//
+
+namespace muse::audio::dsp {
+/// dst[i] += src[i]
+inline void addSamples(float* dst, const float* src, size_t count)
+{
+    using fx::simd::float_x4;
+
+    const size_t simdCount = count - count % 4;
+    size_t i = 0;
+
+    for (; i < simdCount; i += 4) {
+        float_x4 sum = fx::simd::load_unaligned(dst + i) + fx::simd::load_unaligned(src + i);
+        fx::simd::store_unaligned(dst + i, sum);
+    }
+
+    for (; i < count; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+/// dst[i] += src[i] * multiplier
+inline void multiplyAndAddSamples(float* dst, const float* src, float multiplier, size_t count)
+{
+    using fx::simd::float_x4;
+
+    const float_x4 multiplier_x4 = multiplier;
+    const size_t simdCount = count - count % 4;
+    size_t i = 0;
+
+    for (; i < simdCount; i += 4) {
+        float_x4 sum = fx::simd::load_unaligned(dst + i) + fx::simd::load_unaligned(src + i) * multiplier_x4;
+        fx::simd::store_unaligned(dst + i, sum);
+    }
+
+    for (; i < count; ++i) {
+        dst[i] += src[i] * multiplier;
+    }
+}
+
+/// buffer[i] *= multiplier
+inline void multiplySamples(float* buffer, float multiplier, size_t count)
+{
+    using fx::simd::float_x4;
+
+    const float_x4 multiplier_x4 = multiplier;
+    const size_t simdCount = count - count % 4;
+    size_t i = 0;
+
+    for (; i < simdCount; i += 4) {
+        fx::simd::store_unaligned(buffer + i, fx::simd::load_unaligned(buffer + i) * multiplier_x4);
+    }
+
+    for (; i < count; ++i) {
+        buffer[i] *= multiplier;
+    }
+}
+
+/// Multiplies every channel of the interleaved buffer by its own gain
+/// and writes the sum of the squared results of each channel to squaredSums
+inline void multiplyChannelsAndSumSquares(float* buffer, audioch_t channelsCount, samples_t samplesPerChannel,
+                                          const gain_t* gains, float* squaredSums)
+{
+    using fx::simd::float_x4;
+
+    for (audioch_t ch = 0; ch < channelsCount; ++ch) {
+        squaredSums[ch] = 0.f;
+    }
+
+    const size_t count = static_cast<size_t>(samplesPerChannel) * channelsCount;
+    const size_t simdCount = count - count % 4;
+    size_t i = 0;
+
+    // a simd vector covers whole frames only if the channels count divides 4
+    if (channelsCount == 1 || channelsCount == 2 || channelsCount == 4) {
+        const float_x4 gains_x4 = { gains[0], gains[1 % channelsCount], gains[2 % channelsCount], gains[3 % channelsCount] };
+        float_x4 squaredSums_x4 = 0.f;
+
+        for (; i < simdCount; i += 4) {
+            float_x4 result = fx::simd::load_unaligned(buffer + i) * gains_x4;
+            fx::simd::store_unaligned(buffer + i, result);
+            squaredSums_x4 = squaredSums_x4 + result * result;
+        }
+
+        float lanes[4];
+        fx::simd::store_unaligned(lanes, squaredSums_x4);
+
+        for (int lane = 0; lane < 4; ++lane) {
+            squaredSums[lane % channelsCount] += lanes[lane];
+        }
+    }
+
+    for (; i < count; ++i) {
+        const audioch_t ch = static_cast<audioch_t>(i % channelsCount);
+        const float result = buffer[i] * gains[ch];
+        buffer[i] = result;
+        squaredSums[ch] += result * result;
+    }
+}
+}
+
+#endif // MUSE_AUDIO_SAMPLEOPS_H
@@ -40,6 +40,8 @@ public:
 
     virtual ~AbstractAudioEncoder() = default;
 
+    //! NOTE totalSamplesNumber is the expected number of samples per channel,
+    //! the data itself is passed to encode() in chunks
     virtual bool init(const io::path_t& path, const SoundTrackFormat& format, const samples_t totalSamplesNumber)
     {
         if (!format.isValid()) {
@@ -52,7 +54,7 @@ public:
             return false;
         }
 
-        prepareOutputBuffer(totalSamplesNumber);
+        prepareOutputBuffer(format.samplesPerChannel);
 
         return true;
     }
@@ -67,7 +69,11 @@ public:
         return m_format;
     }
 
+    //! NOTE Encodes the next chunk of interleaved samples, can be called many times.
+    //! Returns the number of encoded samples per channel, 0 on failure
     virtual size_t encode(samples_t samplesPerChannel, const float* input) = 0;
+
+    //! NOTE Writes the remaining data, must be called once after the last chunk
     virtual size_t flush() = 0;
 
     Progress progress()
@@ -76,7 +82,7 @@ public:
     }
 
 protected:
-    virtual size_t requiredOutputBufferSize(samples_t totalSamplesNumber) const = 0;
+    virtual size_t requiredOutputBufferSize(samples_t samplesPerChannel) const = 0;
 
     virtual void prepareWriting()
     {
@@ -107,9 +113,12 @@ protected:
         return true;
     }
 
-    virtual void prepareOutputBuffer(const samples_t totalSamplesNumber)
+    virtual void prepareOutputBuffer(const samples_t samplesPerChannel)
     {
-        m_outputBuffer.resize(requiredOutputBufferSize(totalSamplesNumber));
+        const size_t requiredSize = requiredOutputBufferSize(samplesPerChannel);
+        if (m_outputBuffer.size() < requiredSize) {
+            m_outputBuffer.resize(requiredSize);
+        }
     }
 
     virtual void closeDestination()
@@ -80,26 +80,32 @@ bool Mp3Encoder::init(const io::path_t& path, const SoundTrackFormat& format, co
     return true;
 }
 
-size_t Mp3Encoder::requiredOutputBufferSize(samples_t totalSamplesNumber) const
+size_t Mp3Encoder::requiredOutputBufferSize(samples_t samplesPerChannel) const
 {
-    //!Note See thirdparty/lame/API
+    //!Note See thirdparty/lame/API, the worst case is 1.25 * samples + 7200 bytes
 
-    return totalSamplesNumber;
+    return samplesPerChannel + samplesPerChannel / 4 + 7200;
 }
 
 size_t Mp3Encoder::encode(samples_t samplesPerChannel, const float* input)
 {
-    m_progress.progress(0, 100, "");
+    prepareOutputBuffer(samplesPerChannel);
 
+    //! NOTE LAME keeps incomplete frames internally, so a chunk may produce no bytes at all
     int encodedBytes = lame_encode_buffer_interleaved_ieee_float(m_handler->flags, input, samplesPerChannel,
                                                                  m_outputBuffer.data(),
                                                                  static_cast<int>(m_outputBuffer.size()));
+    if (encodedBytes < 0) {
+        LOGE() << "Unable to encode, error: " << encodedBytes;
+        return 0;
+    }
 
-    m_progress.progress(50, 100, "");
-    size_t result = std::fwrite(m_outputBuffer.data(), sizeof(unsigned char), encodedBytes, m_fileStream);
-    m_progress.progress(100, 100, "");
+    size_t written = std::fwrite(m_outputBuffer.data(), sizeof(unsigned char), encodedBytes, m_fileStream);
+    if (written != static_cast<size_t>(encodedBytes)) {
+        return 0;
+    }
 
-    return result;
+    return samplesPerChannel;
 }
 
 size_t Mp3Encoder::flush()
@@ -37,7 +37,7 @@ public:
     size_t flush() override;
 
 private:
-    size_t requiredOutputBufferSize(samples_t totalSamplesNumber) const override;
+    size_t requiredOutputBufferSize(samples_t samplesPerChannel) const override;
     void closeDestination() override;
 
     LameHandler* m_handler = nullptr;
@@ -35,16 +35,15 @@ using namespace muse::audio::encode;
 
 size_t OggEncoder::encode(samples_t samplesPerChannel, const float* input)
 {
-    m_progress.progress(0, 100, "");
-    int code = ope_encoder_write_float(m_opusEncoder, input, samplesPerChannel + m_format.sampleRate * 2);
-    m_progress.progress(100, 100, "");
+    int code = ope_encoder_write_float(m_opusEncoder, input, samplesPerChannel);
 
     return code == OPE_OK ? samplesPerChannel : 0;
 }
 
 size_t OggEncoder::flush()
 {
-    return ope_encoder_flush_header(m_opusEncoder);
+    //! NOTE Encodes the buffered samples, including the encoder lookahead
+    return ope_encoder_drain(m_opusEncoder);
 }
 
 size_t OggEncoder::requiredOutputBufferSize(samples_t /*totalSamplesNumber*/) const
@@ -87,43 +87,50 @@ size_t WavEncoder::encode(samples_t samplesPerChannel, const float* input)
         return 0;
     }
 
-    WavHeader header;
-    header.chunkSize = 18; // 18 is 2 bytes more to include cbsize field / extension size
-    header.bitsPerSample = 32;
-    header.code = 3; // IEEE_FLOAT = 3, PCM = 1
-    header.audioChannelsNumber = m_format.audioChannelsNumber;
-    header.sampleRate = m_format.sampleRate;
-    header.samplesPerChannel = samplesPerChannel;
+    if (!m_headerWritten) {
+        writeHeader();
+    }
 
-    header.write(m_fileStream);
+    const size_t samplesNumber = samplesPerChannel * m_format.audioChannelsNumber;
+    m_fileStream.write(reinterpret_cast<const char*>(input), samplesNumber * sizeof(float));
 
-    int total = header.samplesPerChannel;
-    int progressStep = (total * 5) / 100; // every 5%
-    QVector<samples_t> progressValues;
-    for (samples_t sampleIdx = 0; sampleIdx < header.samplesPerChannel;) {
-        progressValues << sampleIdx;
-        sampleIdx += progressStep;
+    if (!m_fileStream.good()) {
+        return 0;
     }
 
-    for (samples_t sampleIdx = 0; sampleIdx < header.samplesPerChannel; ++sampleIdx) {
-        for (audioch_t audioChNum = 0; audioChNum < m_format.audioChannelsNumber; ++audioChNum) {
-            int idx = sampleIdx * m_format.audioChannelsNumber + audioChNum;
-            m_fileStream.write(reinterpret_cast<const char*>(input + idx), 4);
-        }
+    m_samplesPerChannelWritten += samplesPerChannel;
 
-        if (progressValues.contains(sampleIdx)) {
-            m_progress.progress(sampleIdx, total, "");
-        }
+    return samplesPerChannel;
+}
+
+size_t WavEncoder::flush()
+{
+    if (!m_fileStream.is_open()) {
+        return 0;
     }
 
-    return samplesPerChannel * m_format.audioChannelsNumber;
+    //! NOTE The data size is known only now, so rewrite the header
+    m_fileStream.seekp(0);
+    writeHeader();
+    m_fileStream.seekp(0, std::ios_base::end);
+    m_fileStream.flush();
+
+    return m_samplesPerChannelWritten;
 }
 
-size_t WavEncoder::flush()
+void WavEncoder::writeHeader()
 {
-    NOT_SUPPORTED;
+    WavHeader header;
+    header.chunkSize = 18; // 18 is 2 bytes more to include cbsize field / extension size
+    header.bitsPerSample = 32;
+    header.code = 3; // IEEE_FLOAT = 3, PCM = 1
+    header.audioChannelsNumber = m_format.audioChannelsNumber;
+    header.sampleRate = m_format.sampleRate;
+    header.samplesPerChannel = static_cast<uint32_t>(m_samplesPerChannelWritten);
+
+    header.write(m_fileStream);
 
-    return 0;
+    m_headerWritten = true;
 }
 
 size_t WavEncoder::requiredOutputBufferSize(samples_t totalSamplesNumber) const
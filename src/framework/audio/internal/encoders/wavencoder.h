@@ -40,7 +40,11 @@ protected:
     void closeDestination() override;
 
 private:
+    void writeHeader();
+
     std::ofstream m_fileStream;
+    bool m_headerWritten = false;
+    uint64_t m_samplesPerChannelWritten = 0;
 };
 }
 
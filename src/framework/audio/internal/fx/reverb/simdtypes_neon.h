@@ -139,6 +139,18 @@ __finl float_x4 __vecc operator*(float_x4 a, float_x4 b)
 {
     return vmulq_f32(a.s, b.s);
 }
+
+/// loads 4 floats, src doesn't need to be aligned
+__finl float_x4 __vecc load_unaligned(const float* src)
+{
+    return vld1q_f32(src);
+}
+
+/// stores 4 floats, dst doesn't need to be aligned
+__finl void __vecc store_unaligned(float* dst, float_x4 a)
+{
+    vst1q_f32(dst, a.s);
+}
 } // namespace muse::audio::fx
 
 #endif // MUSE_AUDIO_SIMDTYPES_NEON_H
@@ -134,6 +134,18 @@ __finl float_x4 __vecc operator*(float_x4 a, float_x4 b)
 {
     return _mm_mul_ps(a.s, b.s);
 }
+
+/// loads 4 floats, src doesn't need to be aligned
+__finl float_x4 __vecc load_unaligned(const float* src)
+{
+    return _mm_loadu_ps(src);
+}
+
+/// stores 4 floats, dst doesn't need to be aligned
+__finl void __vecc store_unaligned(float* dst, float_x4 a)
+{
+    _mm_storeu_ps(dst, a.s);
+}
 } // namespace muse::audio::fx
 
 #endif // MUSE_AUDIO_SIMDTYPES_SSE2_H
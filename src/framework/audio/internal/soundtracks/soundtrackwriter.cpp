@@ -22,6 +22,8 @@
 
 #include "soundtrackwriter.h"
 
+#include <thread>
+
 #include "global/defer.h"
 
 #include "internal/worker/audioengine.h"
@@ -38,8 +40,9 @@ using namespace muse;
 using namespace muse::audio;
 using namespace muse::audio::soundtrack;
 
-static constexpr int PREPARE_STEP = 0;
-static constexpr int ENCODE_STEP = 1;
+//! NOTE The ring of chunks bounds the memory used by the export: 4 chunks of 64 render steps, i.e. 256 render steps
+static constexpr size_t CHUNKS_COUNT = 4;
+static constexpr samples_t RENDER_STEPS_PER_CHUNK = 64;
 
 static encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType type)
 {
@@ -56,18 +59,22 @@ static encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType type)
 }
 
 SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format,
-                                   const msecs_t totalDuration, IAudioSourcePtr source,
+                                   const msecs_t totalDuration, MixerPtr mixer,
                                    const modularity::ContextPtr& iocCtx)
-    : muse::Injectable(iocCtx), m_source(std::move(source))
+    : muse::Injectable(iocCtx), m_mixer(std::move(mixer))
 {
-    if (!m_source) {
+    if (!m_mixer) {
         return;
     }
 
-    samples_t totalSamplesNumber = (totalDuration / 1000000.f) * sizeof(float) * format.sampleRate;
-    m_inputBuffer.resize(totalSamplesNumber);
-    m_intermBuffer.resize(format.samplesPerChannel * format.audioChannelsNumber);
+    m_totalSamplesPerChannel = (totalDuration / 1000000.f) * format.sampleRate;
     m_renderStep = format.samplesPerChannel;
+    m_chunkSize = m_renderStep * RENDER_STEPS_PER_CHUNK;
+
+    m_chunks.resize(CHUNKS_COUNT);
+    for (Chunk& chunk : m_chunks) {
+        chunk.buffer.resize(m_chunkSize * format.audioChannelsNumber);
+    }
 
     m_encoderPtr = createEncoder(format.type);
 
@@ -75,10 +82,7 @@ SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTra
         return;
     }
 
-    m_encoderPtr->init(destination, format, totalSamplesNumber);
-    m_encoderPtr->progress().progressChanged().onReceive(this, [this](int64_t current, int64_t total, std::string) {
-        sendStepProgress(ENCODE_STEP, current, total);
-    });
+    m_encoderPtr->init(destination, format, m_totalSamplesPerChannel);
 }
 
 SoundTrackWriter::~SoundTrackWriter()
@@ -92,42 +96,27 @@ Ret SoundTrackWriter::write()
 {
     TRACEFUNC;
 
-    if (!m_source || !m_encoderPtr) {
+    if (!m_mixer || !m_encoderPtr) {
         return false;
     }
 
     audioEngine()->setMode(RenderMode::OfflineMode);
 
-    m_source->setSampleRate(m_encoderPtr->format().sampleRate);
-    m_source->setIsActive(true);
+    m_mixer->setSampleRate(m_encoderPtr->format().sampleRate);
+    m_mixer->setIsActive(true);
 
     DEFER {
         m_encoderPtr->flush();
 
         audioEngine()->setMode(RenderMode::IdleMode);
 
-        m_source->setSampleRate(audioEngine()->sampleRate());
-        m_source->setIsActive(false);
+        m_mixer->setSampleRate(audioEngine()->sampleRate());
+        m_mixer->setIsActive(false);
 
         m_isAborted = false;
     };
 
-    Ret ret = generateAudioData();
-    if (!ret) {
-        return ret;
-    }
-
-    size_t bytes = m_encoderPtr->encode(m_inputBuffer.size() / sizeof(float), m_inputBuffer.data());
-
-    if (m_isAborted) {
-        return make_ret(Ret::Code::Cancel);
-    }
-
-    if (bytes == 0) {
-        return make_ret(Err::ErrorEncode);
-    }
-
-    return muse::make_ok();
+    return generateAudioData();
 }
 
 void SoundTrackWriter::abort()
@@ -144,29 +133,65 @@ Ret SoundTrackWriter::generateAudioData()
 {
     TRACEFUNC;
 
-    const size_t inputBufferMaxOffset = m_inputBuffer.size();
-    size_t inputBufferOffset = 0;
+    m_renderedChunksCount = 0;
+    m_encodedChunksCount = 0;
+    m_isRenderingFinished = false;
+    m_isEncodingFailed = false;
 
-    sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
+    //! NOTE Rendering stays on this (audio engine) thread, the encoding runs concurrently
+    std::thread encodeThread([this]() {
+        encodeAudioData();
+    });
+
+    samples_t renderedSamplesPerChannel = 0;
+    sendProgress(0, m_totalSamplesPerChannel);
+
+    while (renderedSamplesPerChannel < m_totalSamplesPerChannel && !m_isAborted) {
+        Chunk* chunk = nullptr;
+
+        {
+            std::unique_lock lock(m_chunksMutex);
+            m_chunksChanged.wait(lock, [this]() {
+                return m_renderedChunksCount - m_encodedChunksCount < m_chunks.size() || m_isEncodingFailed;
+            });
 
-    while (inputBufferOffset < inputBufferMaxOffset && !m_isAborted) {
-        m_source->process(m_intermBuffer.data(), m_renderStep);
+            if (m_isEncodingFailed) {
+                break;
+            }
 
-        size_t samplesToCopy = std::min(m_intermBuffer.size(), inputBufferMaxOffset - inputBufferOffset);
+            chunk = &m_chunks.at(m_renderedChunksCount % m_chunks.size());
+        }
 
-        std::copy(m_intermBuffer.begin(),
-                  m_intermBuffer.begin() + samplesToCopy,
-                  m_inputBuffer.begin() + inputBufferOffset);
+        chunk->samplesPerChannel = std::min(m_chunkSize, m_totalSamplesPerChannel - renderedSamplesPerChannel);
+        m_mixer->processBlock(chunk->buffer.data(), chunk->samplesPerChannel, m_renderStep);
+        renderedSamplesPerChannel += chunk->samplesPerChannel;
 
-        inputBufferOffset += samplesToCopy;
-        sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
+        {
+            std::lock_guard lock(m_chunksMutex);
+            ++m_renderedChunksCount;
+        }
+        m_chunksChanged.notify_all();
+
+        sendProgress(renderedSamplesPerChannel, m_totalSamplesPerChannel);
+    }
+
+    {
+        std::lock_guard lock(m_chunksMutex);
+        m_isRenderingFinished = true;
     }
+    m_chunksChanged.notify_all();
+
+    encodeThread.join();
 
     if (m_isAborted) {
         return make_ret(Ret::Code::Cancel);
     }
 
-    if (inputBufferOffset == 0) {
+    if (m_isEncodingFailed) {
+        return make_ret(Err::ErrorEncode);
+    }
+
+    if (renderedSamplesPerChannel == 0) {
         LOGI() << "No audio to export";
         return make_ret(Err::NoAudioToExport);
     }
@@ -174,10 +199,45 @@ Ret SoundTrackWriter::generateAudioData()
     return muse::make_ok();
 }
 
-void SoundTrackWriter::sendStepProgress(int step, int64_t current, int64_t total)
+void SoundTrackWriter::encodeAudioData()
+{
+    while (true) {
+        const Chunk* chunk = nullptr;
+
+        {
+            std::unique_lock lock(m_chunksMutex);
+            m_chunksChanged.wait(lock, [this]() {
+                return m_encodedChunksCount < m_renderedChunksCount || m_isRenderingFinished;
+            });
+
+            if (m_encodedChunksCount == m_renderedChunksCount) {
+                return;
+            }
+
+            chunk = &m_chunks.at(m_encodedChunksCount % m_chunks.size());
+        }
+
+        // the chunk is not touched by the renderer until it is released below
+        size_t encoded = m_encoderPtr->encode(chunk->samplesPerChannel, chunk->buffer.data());
+
+        {
+            std::lock_guard lock(m_chunksMutex);
+            if (encoded == 0) {
+                m_isEncodingFailed = true;
+            } else {
+                ++m_encodedChunksCount;
+            }
+        }
+        m_chunksChanged.notify_all();
+
+        if (encoded == 0) {
+            return;
+        }
+    }
+}
+
+void SoundTrackWriter::sendProgress(int64_t current, int64_t total)
 {
-    int stepRange = step == PREPARE_STEP ? 80 : 20;
-    int stepProgressStart = step == PREPARE_STEP ? 0 : 80;
-    int stepCurrentProgress = stepProgressStart + ((current * 100 / total) * stepRange) / 100;
-    m_progress.progress(stepCurrentProgress, 100, "");
+    int currentProgress = total > 0 ? static_cast<int>(current * 100 / total) : 100;
+    m_progress.progress(currentProgress, 100, "");
 }
@@ -23,14 +23,17 @@
 #ifndef MUSE_AUDIO_SOUNDTRACKWRITER_H
 #define MUSE_AUDIO_SOUNDTRACKWRITER_H
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 
 #include "global/async/asyncable.h"
 #include "global/modularity/ioc.h"
 
 #include "audiotypes.h"
-#include "iaudiosource.h"
 #include "../worker/iaudioengine.h"
+#include "../worker/mixer.h"
 #include "../encoders/abstractaudioencoder.h"
 
 namespace muse::audio::soundtrack {
@@ -39,7 +42,7 @@ class SoundTrackWriter : public muse::Injectable, public async::Asyncable
     muse::Inject<IAudioEngine> audioEngine = { this };
 
 public:
-    SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration, IAudioSourcePtr source,
+    SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration, MixerPtr mixer,
                      const muse::modularity::ContextPtr& iocCtx);
     ~SoundTrackWriter() override;
 
@@ -49,15 +52,31 @@ public:
     Progress progress();
 
 private:
+    struct Chunk {
+        std::vector<float> buffer;
+        samples_t samplesPerChannel = 0;
+    };
+
     Ret generateAudioData();
+    void encodeAudioData();
+
+    void sendProgress(int64_t current, int64_t total);
 
-    void sendStepProgress(int step, int64_t current, int64_t total);
+    MixerPtr m_mixer = nullptr;
 
-    IAudioSourcePtr m_source = nullptr;
+    //! NOTE The rendered chunks are passed to the encoder thread through this ring,
+    //! so only a few chunks are kept in memory, regardless of the duration
+    std::vector<Chunk> m_chunks;
+    size_t m_renderedChunksCount = 0;
+    size_t m_encodedChunksCount = 0;
+    bool m_isRenderingFinished = false;
+    bool m_isEncodingFailed = false;
+    std::mutex m_chunksMutex;
+    std::condition_variable m_chunksChanged;
 
-    std::vector<float> m_inputBuffer;
-    std::vector<float> m_intermBuffer;
     samples_t m_renderStep = 0;
+    samples_t m_chunkSize = 0;
+    samples_t m_totalSamplesPerChannel = 0;
 
     encode::AbstractAudioEncoderPtr m_encoderPtr = nullptr;
 
@@ -100,7 +100,7 @@ int FluidSequencer::lastStaff() const
     return m_lastStaff;
 }
 
-void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes)
+void FluidSequencer::updatePlaybackEvents(EventList& destination, const mpe::PlaybackEventsMap& changes)
 {
     SostenutoTimeAndDurations sostenutoTimeAndDurations;
 
@@ -129,14 +129,14 @@ void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const m
             noteOn.setVelocity16(velocity);
             noteOn.setPitchNote(noteIdx, tuning);
 
-            destination[timestampFrom].emplace(std::move(noteOn));
+            destination.add(timestampFrom, std::move(noteOn));
 
             midi::Event noteOff(Event::Opcode::NoteOff, Event::MessageType::ChannelVoice20);
             noteOff.setChannel(channelIdx);
             noteOff.setNote(noteIdx);
             noteOff.setPitchNote(noteIdx, tuning);
 
-            destination[timestampTo].emplace(std::move(noteOff));
+            destination.add(timestampTo, std::move(noteOff));
 
             for (const auto& artPair : noteEvent.expressionCtx().articulations) {
                 const mpe::ArticulationMeta& meta = artPair.second.meta;
@@ -165,7 +165,7 @@ void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const m
     appendSostenutoEvents(destination, sostenutoTimeAndDurations);
 }
 
-void FluidSequencer::updateDynamicEvents(EventSequenceMap& destination, const mpe::DynamicLevelLayers& changes)
+void FluidSequencer::updateDynamicEvents(EventList& destination, const mpe::DynamicLevelLayers& changes)
 {
     for (const auto& layer : changes) {
         for (const auto& dynamic : layer.second) {
@@ -173,12 +173,12 @@ void FluidSequencer::updateDynamicEvents(EventSequenceMap& destination, const mp
             event.setIndex(midi::EXPRESSION_CONTROLLER);
             event.setData(expressionLevel(dynamic.second));
 
-            destination[dynamic.first].emplace(std::move(event));
+            destination.add(dynamic.first, std::move(event));
         }
     }
 }
 
-void FluidSequencer::appendControlChange(EventSequenceMap& destination, const mpe::timestamp_t timestamp,
+void FluidSequencer::appendControlChange(EventList& destination, const mpe::timestamp_t timestamp,
                                          const int midiControlIdx, const channel_t channelIdx, const uint32_t value)
 {
     midi::Event cc(Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
@@ -186,10 +186,10 @@ void FluidSequencer::appendControlChange(EventSequenceMap& destination, const mp
     cc.setChannel(channelIdx);
     cc.setData(value);
 
-    destination[timestamp].emplace(std::move(cc));
+    destination.add(timestamp, std::move(cc));
 }
 
-void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::appendPitchBend(EventList& destination, const mpe::NoteEvent& noteEvent,
                                      const mpe::ArticulationMeta& artMeta, const channel_t channelIdx)
 {
     if (noteEvent.pitchCtx().pitchCurve.empty()) {
@@ -202,7 +202,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
     midi::Event event(Event::Opcode::PitchBend, Event::MessageType::ChannelVoice10);
     event.setChannel(channelIdx);
     event.setData(8192);
-    destination[pitchBendTimestampTo].insert(event);
+    destination.add(pitchBendTimestampTo, event);
 
     auto currIt = noteEvent.pitchCtx().pitchCurve.cbegin();
     auto nextIt = std::next(currIt);
@@ -236,13 +236,13 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
 
             if (time < pitchBendTimestampTo) {
                 event.setData(bendValue);
-                destination[time].insert(event);
+                destination.add(time, event);
             }
         }
     }
 }
 
-void FluidSequencer::appendSostenutoEvents(EventSequenceMap& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations)
+void FluidSequencer::appendSostenutoEvents(EventList& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations)
 {
     for (const auto& channelPair : sostenutoTimeAndDurations) {
         for (size_t i = 0; i < channelPair.second.size(); ++i) {
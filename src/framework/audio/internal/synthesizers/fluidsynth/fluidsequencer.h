@@ -49,17 +49,17 @@ private:
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics,
                                 const mpe::PlaybackParamLayers& params) override;
 
-    void updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes);
-    void updateDynamicEvents(EventSequenceMap& destination, const mpe::DynamicLevelLayers& changes);
+    void updatePlaybackEvents(EventList& destination, const mpe::PlaybackEventsMap& changes);
+    void updateDynamicEvents(EventList& destination, const mpe::DynamicLevelLayers& changes);
 
-    void appendControlChange(EventSequenceMap& destination, const mpe::timestamp_t timestamp, const int midiControlIdx,
+    void appendControlChange(EventList& destination, const mpe::timestamp_t timestamp, const int midiControlIdx,
                              const midi::channel_t channelIdx, const uint32_t value);
 
-    void appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationMeta& artMeta,
+    void appendPitchBend(EventList& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationMeta& artMeta,
                          const midi::channel_t channelIdx);
 
     using SostenutoTimeAndDurations = std::map<midi::channel_t, std::vector<mpe::TimestampAndDuration> >;
-    void appendSostenutoEvents(EventSequenceMap& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations);
+    void appendSostenutoEvents(EventList& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations);
 
     midi::channel_t channel(const mpe::NoteEvent& noteEvent) const;
     midi::note_idx_t noteIndex(const mpe::pitch_level_t pitchLevel) const;
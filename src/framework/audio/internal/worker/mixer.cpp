@@ -25,6 +25,7 @@
 
 #include "internal/audiosanitizer.h"
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/sampleops.h"
 #include "audioerrors.h"
 
 #include "log.h"
@@ -103,9 +104,23 @@ RetVal<MixerChannelPtr> Mixer::addChannel(const TrackId trackId, ITrackAudioInpu
         }
     });
 
-    m_trackChannels.emplace(trackId, channel);
+    auto it = std::lower_bound(m_trackChannels.begin(), m_trackChannels.end(), trackId,
+                               [](const TrackChannelInfo& info, const TrackId id) { return info.channel->trackId() < id; });
 
-    result.val = m_trackChannels[trackId];
+    if (it == m_trackChannels.end() || it->channel->trackId() != trackId) {
+        const samples_t samplesToPreallocate = configuration()->samplesToPreallocate();
+        const audioch_t audioChannelsCount = configuration()->audioChannelsCount();
+
+        TrackChannelInfo info;
+        info.channel = channel;
+        info.buffer = std::vector<float>(samplesToPreallocate * audioChannelsCount, 0.f);
+        info.silentSteps = std::vector<uint8_t>(1, 1);
+
+        it = m_trackChannels.insert(it, std::move(info));
+        m_trackChannelsToProcess.reserve(m_trackChannels.size());
+    }
+
+    result.val = it->channel;
     result.ret = make_ret(Ret::Code::Ok);
 
     return result;
@@ -137,14 +152,16 @@ Ret Mixer::removeChannel(const TrackId trackId)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    auto search = m_trackChannels.find(trackId);
+    auto search = std::find_if(m_trackChannels.begin(), m_trackChannels.end(), [trackId](const TrackChannelInfo& info) {
+        return info.channel->trackId() == trackId;
+    });
 
-    if (search != m_trackChannels.end() && search->second) {
+    if (search != m_trackChannels.end()) {
         if (m_nonMutedTrackCount != 0) {
             m_nonMutedTrackCount--;
         }
 
-        m_trackChannels.erase(trackId);
+        m_trackChannels.erase(search);
         return make_ret(Ret::Code::Ok);
     }
 
@@ -160,6 +177,8 @@ void Mixer::setAudioChannelsCount(const audioch_t count)
     ONLY_AUDIO_WORKER_THREAD;
 
     m_audioChannelsCount = count;
+    m_channelGains.resize(count);
+    m_channelSquaredSums.resize(count);
 }
 
 void Mixer::setSampleRate(unsigned int sampleRate)
@@ -170,8 +189,8 @@ void Mixer::setSampleRate(unsigned int sampleRate)
 
     AbstractAudioSource::setSampleRate(sampleRate);
 
-    for (auto& channel : m_trackChannels) {
-        channel.second->setSampleRate(sampleRate);
+    for (TrackChannelInfo& info : m_trackChannels) {
+        info.channel->setSampleRate(sampleRate);
     }
 
     for (AuxChannelInfo& aux : m_auxChannelInfoList) {
@@ -206,27 +225,55 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    TracksData tracksData;
-    processTrackChannels(outBufferSize, samplesPerChannel, tracksData);
+    processTrackChannels(samplesPerChannel, samplesPerChannel);
 
-    prepareAuxBuffers(outBufferSize);
+    return mixTrackChannels(outBuffer, 0, 0, samplesPerChannel);
+}
 
-    for (auto& pair : tracksData) {
-        auto channelIt = m_trackChannels.find(pair.first);
-        if (channelIt == m_trackChannels.cend()) {
-            continue;
+samples_t Mixer::processBlock(float* outBuffer, samples_t samplesPerChannel, samples_t stepSamplesPerChannel)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(stepSamplesPerChannel > 0) {
+        return 0;
+    }
+
+    std::fill(outBuffer, outBuffer + samplesPerChannel * m_audioChannelsCount, 0.f);
+
+    processTrackChannels(samplesPerChannel, stepSamplesPerChannel);
+
+    samples_t processedSamples = 0;
+    size_t stepIdx = 0;
+
+    for (samples_t stepOffset = 0; stepOffset < samplesPerChannel; stepOffset += stepSamplesPerChannel, ++stepIdx) {
+        const samples_t stepSamples = std::min(stepSamplesPerChannel, samplesPerChannel - stepOffset);
+
+        for (const IClockPtr& clock : m_clocks) {
+            clock->forward((stepSamples * 1000000) / m_sampleRate);
         }
 
-        const MixerChannelPtr& channel = channelIt->second;
-        if (!channel->isSilent()) {
+        float* stepOutBuffer = outBuffer + stepOffset * m_audioChannelsCount;
+        processedSamples += mixTrackChannels(stepOutBuffer, stepIdx, stepOffset, stepSamples);
+    }
+
+    return processedSamples;
+}
+
+samples_t Mixer::mixTrackChannels(float* outBuffer, size_t stepIdx, samples_t stepOffset, samples_t samplesPerChannel)
+{
+    prepareAuxBuffers(samplesPerChannel * m_audioChannelsCount);
+
+    for (const TrackChannelInfo* info : m_trackChannelsToProcess) {
+        const MixerChannelPtr& channel = info->channel;
+        if (!info->silentSteps[stepIdx]) {
             m_isSilence = false;
         } else if (m_isSilence) {
             continue;
         }
 
-        const std::vector<float>& trackBuffer = pair.second;
-        mixOutputFromChannel(outBuffer, trackBuffer.data(), samplesPerChannel);
-        writeTrackToAuxBuffers(trackBuffer.data(), channel->outputParams().auxSends, samplesPerChannel);
+        const float* trackBuffer = info->buffer.data() + stepOffset * m_audioChannelsCount;
+        mixOutputFromChannel(outBuffer, trackBuffer, samplesPerChannel);
+        writeTrackToAuxBuffers(trackBuffer, channel->outputParams().auxSends, samplesPerChannel);
     }
 
     if (m_masterParams.muted || samplesPerChannel == 0 || m_isSilence) {
@@ -246,60 +293,66 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
     return samplesPerChannel;
 }
 
-void Mixer::processTrackChannels(size_t outBufferSize, size_t samplesPerChannel, TracksData& outTracksData)
+void Mixer::processTrackChannels(samples_t samplesPerChannel, samples_t stepSamplesPerChannel)
 {
-    auto processChannel = [outBufferSize, samplesPerChannel](MixerChannelPtr channel) -> std::vector<float> {
-        thread_local std::vector<float> buffer(outBufferSize, 0.f);
-        thread_local std::vector<float> silent_buffer(outBufferSize, 0.f);
+    //! NOTE The list is reserved in addChannel and parallelFor does not allocate,
+    //! only the channels themselves and the rare buffer growth may do it
+    AUDIO_NO_ALLOCATION_SCOPE;
+
+    m_trackChannelsToProcess.clear();
 
-        if (buffer.size() < outBufferSize) {
-            buffer.resize(outBufferSize, 0.f);
-            silent_buffer.resize(outBufferSize, 0.f);
+    const size_t bufferSize = samplesPerChannel * m_audioChannelsCount;
+    const size_t stepsCount = stepSamplesPerChannel > 0 ? (samplesPerChannel + stepSamplesPerChannel - 1) / stepSamplesPerChannel : 1;
+
+    bool filterTracks = m_isIdle && !m_tracksToProcessWhenIdle.empty();
+
+    for (TrackChannelInfo& info : m_trackChannels) {
+        if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, info.channel->trackId())) {
+            continue;
         }
 
-        buffer = silent_buffer;
+        if (info.channel->muted() && info.channel->isSilent()) {
+            //! NOTE The signal notification copies the values into the async channel
+            AUDIO_ALLOW_ALLOCATION_SCOPE;
+            info.channel->notifyNoAudioSignal();
+            continue;
+        }
 
-        if (channel) {
-            channel->process(buffer.data(), samplesPerChannel);
+        //! NOTE Only happens if the buffer size has grown beyond the preallocated one,
+        //! or when a whole block is rendered offline
+        if (info.buffer.size() < bufferSize || info.silentSteps.size() < stepsCount) {
+            AUDIO_ALLOW_ALLOCATION_SCOPE;
+            info.buffer.resize(std::max(info.buffer.size(), bufferSize), 0.f);
+            info.silentSteps.resize(std::max(info.silentSteps.size(), stepsCount), 1);
         }
 
-        return buffer;
-    };
+        m_trackChannelsToProcess.push_back(&info);
+    }
 
-    bool filterTracks = m_isIdle && !m_tracksToProcessWhenIdle.empty();
+    auto processChannel = [this, samplesPerChannel, stepSamplesPerChannel](size_t idx) {
+        TrackChannelInfo* info = m_trackChannelsToProcess[idx];
+        size_t stepIdx = 0;
 
-    if (useMultithreading()) {
-        std::map<TrackId, std::future<std::vector<float> > > futures;
+        for (samples_t stepOffset = 0; stepOffset < samplesPerChannel; stepOffset += stepSamplesPerChannel, ++stepIdx) {
+            const samples_t stepSamples = std::min(stepSamplesPerChannel, samplesPerChannel - stepOffset);
+            float* stepBuffer = info->buffer.data() + stepOffset * m_audioChannelsCount;
 
-        for (const auto& pair : m_trackChannels) {
-            if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
-                continue;
-            }
+            std::fill(stepBuffer, stepBuffer + stepSamples * m_audioChannelsCount, 0.f);
 
-            if (pair.second->muted() && pair.second->isSilent()) {
-                pair.second->notifyNoAudioSignal();
-                continue;
+            {
+                AUDIO_ALLOW_ALLOCATION_SCOPE;
+                info->channel->process(stepBuffer, stepSamples);
             }
 
-            std::future<std::vector<float> > future = m_taskScheduler->submit(processChannel, pair.second);
-            futures.emplace(pair.first, std::move(future));
+            info->silentSteps[stepIdx] = info->channel->isSilent();
         }
+    };
 
-        for (auto& pair : futures) {
-            outTracksData.emplace(pair.first, pair.second.get());
-        }
+    if (useMultithreading()) {
+        m_taskScheduler->parallelFor(m_trackChannelsToProcess.size(), processChannel);
     } else {
-        for (const auto& pair : m_trackChannels) {
-            if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
-                continue;
-            }
-
-            if (pair.second->muted() && pair.second->isSilent()) {
-                pair.second->notifyNoAudioSignal();
-                continue;
-            }
-
-            outTracksData.emplace(pair.first, processChannel(pair.second));
+        for (size_t idx = 0; idx < m_trackChannelsToProcess.size(); ++idx) {
+            processChannel(idx);
         }
     }
 }
@@ -325,9 +378,9 @@ void Mixer::setIsActive(bool arg)
 
     AbstractAudioSource::setIsActive(arg);
 
-    for (auto& channel : m_trackChannels) {
-        if (!channel.second->muted()) {
-            channel.second->setIsActive(arg);
+    for (TrackChannelInfo& info : m_trackChannels) {
+        if (!info.channel->muted()) {
+            info.channel->setIsActive(arg);
         }
     }
 
@@ -451,15 +504,7 @@ void Mixer::mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsign
         return;
     }
 
-    for (samples_t s = 0; s < samplesCount; ++s) {
-        size_t samplePos = s * m_audioChannelsCount;
-
-        for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
-            size_t idx = samplePos + audioChNum;
-            float sample = inBuffer[idx];
-            outBuffer[idx] += sample;
-        }
-    }
+    dsp::addSamples(outBuffer, inBuffer, static_cast<size_t>(samplesCount) * m_audioChannelsCount);
 }
 
 void Mixer::prepareAuxBuffers(size_t outBufferSize)
@@ -496,17 +541,7 @@ void Mixer::writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParam
             continue;
         }
 
-        float* auxBuffer = aux.buffer.data();
-        float signalAmount = auxSend.signalAmount;
-
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            size_t samplePos = s * m_audioChannelsCount;
-
-            for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
-                size_t idx = samplePos + audioChNum;
-                auxBuffer[idx] += trackBuffer[idx] * signalAmount;
-            }
-        }
+        dsp::multiplyAndAddSamples(aux.buffer.data(), trackBuffer, auxSend.signalAmount, samplesPerChannel * m_audioChannelsCount);
 
         aux.receivedAudioSignal = true;
     }
@@ -538,19 +573,15 @@ void Mixer::completeOutput(float* buffer, samples_t samplesPerChannel)
     float volume = muse::db_to_linear(m_masterParams.volume);
 
     for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * volume;
-
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * m_audioChannelsCount + audioChNum;
+        m_channelGains[audioChNum] = dsp::balanceGain(m_masterParams.balance, audioChNum) * volume;
+    }
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+    dsp::multiplyChannelsAndSumSquares(buffer, m_audioChannelsCount, samplesPerChannel, m_channelGains.data(),
+                                       m_channelSquaredSums.data());
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
-        }
+    for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
+        float singleChannelSquaredSum = m_channelSquaredSums[audioChNum];
+        totalSquaredSum += singleChannelSquaredSum;
 
         float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
         m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
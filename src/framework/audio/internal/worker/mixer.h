@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <map>
+#include <vector>
 
 #include "global/modularity/ioc.h"
 #include "global/async/asyncable.h"
@@ -78,10 +79,14 @@ public:
     samples_t process(float* outBuffer, samples_t samplesPerChannel) override;
     void setIsActive(bool arg) override;
 
-private:
-    using TracksData = std::map<TrackId, std::vector<float> >;
+    //! NOTE Used for the offline rendering. Every track renders the whole block on its own
+    //! (in parallel with the other tracks), then the tracks are mixed step by step,
+    //! so the result is the same as calling process() for every step
+    samples_t processBlock(float* outBuffer, samples_t samplesPerChannel, samples_t stepSamplesPerChannel);
 
-    void processTrackChannels(size_t outBufferSize, size_t samplesPerChannel, TracksData& outTracksData);
+private:
+    void processTrackChannels(samples_t samplesPerChannel, samples_t stepSamplesPerChannel);
+    samples_t mixTrackChannels(float* outBuffer, size_t stepIdx, samples_t stepOffset, samples_t samplesPerChannel);
     void mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsigned int samplesCount) const;
     void prepareAuxBuffers(size_t outBufferSize);
     void writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParams& auxSends, samples_t samplesPerChannel);
@@ -103,7 +108,16 @@ private:
     async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
     std::vector<IFxProcessorPtr> m_masterFxProcessors = {};
 
-    std::map<TrackId, MixerChannelPtr> m_trackChannels = {};
+    struct TrackChannelInfo {
+        MixerChannelPtr channel;
+        std::vector<float> buffer;
+        std::vector<uint8_t> silentSteps;
+    };
+
+    //! NOTE Sorted by track id, the buffers are allocated when a channel is added,
+    //! so that processing doesn't allocate anything on the audio threads
+    std::vector<TrackChannelInfo> m_trackChannels;
+    std::vector<TrackChannelInfo*> m_trackChannelsToProcess;
     std::unordered_set<TrackId> m_tracksToProcessWhenIdle;
 
     struct AuxChannelInfo {
@@ -118,6 +132,8 @@ private:
 
     std::set<IClockPtr> m_clocks;
     audioch_t m_audioChannelsCount = 0;
+    std::vector<gain_t> m_channelGains;
+    std::vector<float> m_channelSquaredSums;
 
     mutable AudioSignalsNotifier m_audioSignalNotifier;
 
@@ -24,6 +24,7 @@
 #include <algorithm>
 
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/sampleops.h"
 #include "internal/audiosanitizer.h"
 
 #include "log.h"
@@ -42,6 +43,14 @@ MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const
     ONLY_AUDIO_WORKER_THREAD;
 
     setSampleRate(sampleRate);
+
+    if (m_audioSource) {
+        setAudioChannelsCount(m_audioSource->audioChannelsCount());
+
+        m_audioSource->audioChannelsCountChanged().onReceive(this, [this](unsigned int audioChannelsCount) {
+            setAudioChannelsCount(audioChannelsCount);
+        });
+    }
 }
 
 MixerChannel::MixerChannel(const TrackId trackId, const unsigned int sampleRate, unsigned int audioChannelsCount,
@@ -50,7 +59,7 @@ MixerChannel::MixerChannel(const TrackId trackId, const unsigned int sampleRate,
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    m_audioChannelsCount = audioChannelsCount;
+    setAudioChannelsCount(audioChannelsCount);
 }
 
 TrackId MixerChannel::trackId() const
@@ -179,6 +188,16 @@ unsigned int MixerChannel::audioChannelsCount() const
     return m_audioSource ? m_audioSource->audioChannelsCount() : m_audioChannelsCount;
 }
 
+//! NOTE The per-channel buffers are sized here, so that completeOutput doesn't allocate on the audio thread
+void MixerChannel::setAudioChannelsCount(unsigned int audioChannelsCount)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_audioChannelsCount = audioChannelsCount;
+    m_channelGains.resize(audioChannelsCount);
+    m_channelSquaredSums.resize(audioChannelsCount);
+}
+
 async::Channel<unsigned int> MixerChannel::audioChannelsCountChanged() const
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -223,21 +242,19 @@ void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount)
     float volume = muse::db_to_linear(m_params.volume);
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * volume;
+    IF_ASSERT_FAILED(m_channelGains.size() >= channelsCount && m_channelSquaredSums.size() >= channelsCount) {
+        return;
+    }
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * channelsCount + audioChNum;
+    for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+        m_channelGains[audioChNum] = dsp::balanceGain(m_params.balance, audioChNum) * volume;
+    }
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+    dsp::multiplyChannelsAndSumSquares(buffer, channelsCount, samplesCount, m_channelGains.data(), m_channelSquaredSums.data());
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
-        }
+    for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+        float singleChannelSquaredSum = m_channelSquaredSums[audioChNum];
+        totalSquaredSum += singleChannelSquaredSum;
 
         float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
         m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
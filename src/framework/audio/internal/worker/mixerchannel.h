@@ -67,6 +67,7 @@ public:
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
 private:
+    void setAudioChannelsCount(unsigned int audioChannelsCount);
     void completeOutput(float* buffer, unsigned int samplesCount);
 
     TrackId m_trackId = -1;
@@ -79,6 +80,8 @@ private:
     std::vector<IFxProcessorPtr> m_fxProcessors = {};
 
     dsp::CompressorPtr m_compressor = nullptr;
+    std::vector<gain_t> m_channelGains;
+    std::vector<float> m_channelSquaredSums;
 
     bool m_isSilent = true;
 
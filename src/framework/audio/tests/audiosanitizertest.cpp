@@ -0,0 +1,73 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "audio/internal/audiosanitizer.h"
+
+using namespace muse::audio;
+
+namespace muse::audio {
+class Audio_AudioSanitizerTest : public ::testing::Test
+{
+};
+}
+
+TEST_F(Audio_AudioSanitizerTest, AllocationScopes)
+{
+    EXPECT_TRUE(AudioSanitizer::isAllocationAllowed());
+
+    {
+        NoAllocationScope noAllocation;
+        EXPECT_FALSE(AudioSanitizer::isAllocationAllowed());
+
+        {
+            NoAllocationScope nested;
+            EXPECT_FALSE(AudioSanitizer::isAllocationAllowed());
+
+            {
+                AllowAllocationScope allowAllocation;
+                EXPECT_TRUE(AudioSanitizer::isAllocationAllowed());
+            }
+
+            EXPECT_FALSE(AudioSanitizer::isAllocationAllowed());
+        }
+
+        EXPECT_FALSE(AudioSanitizer::isAllocationAllowed());
+
+        //! NOTE The restriction only applies to the thread that opened the scope
+        bool allowedOnOtherThread = false;
+        {
+            AllowAllocationScope allowAllocation;
+            std::thread thread([&allowedOnOtherThread]() {
+                allowedOnOtherThread = AudioSanitizer::isAllocationAllowed();
+            });
+            thread.join();
+        }
+
+        EXPECT_TRUE(allowedOnOtherThread);
+    }
+
+    EXPECT_TRUE(AudioSanitizer::isAllocationAllowed());
+}
@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "audio/internal/dsp/sampleops.h"
+
+using namespace muse::audio;
+
+namespace muse::audio {
+class Audio_SampleOpsTest : public ::testing::Test
+{
+public:
+    static std::vector<float> makeSignal(size_t count, float phase)
+    {
+        std::vector<float> result(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            result[i] = std::sin(0.01f * static_cast<float>(i) + phase) * 0.8f;
+        }
+
+        return result;
+    }
+};
+}
+
+// sizes cover empty buffers, buffers shorter than a simd vector and scalar remainders
+static const std::vector<size_t> SAMPLE_COUNTS = { 0, 1, 3, 4, 7, 64, 513 };
+
+TEST_F(Audio_SampleOpsTest, AddSamples)
+{
+    for (size_t count : SAMPLE_COUNTS) {
+        std::vector<float> dst = makeSignal(count, 0.f);
+        const std::vector<float> src = makeSignal(count, 1.f);
+
+        std::vector<float> expected = dst;
+        for (size_t i = 0; i < count; ++i) {
+            expected[i] += src[i];
+        }
+
+        dsp::addSamples(dst.data(), src.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_FLOAT_EQ(dst[i], expected[i]);
+        }
+    }
+}
+
+TEST_F(Audio_SampleOpsTest, MultiplyAndAddSamples)
+{
+    for (size_t count : SAMPLE_COUNTS) {
+        std::vector<float> dst = makeSignal(count, 0.f);
+        const std::vector<float> src = makeSignal(count, 2.f);
+        const float multiplier = 0.35f;
+
+        std::vector<float> expected = dst;
+        for (size_t i = 0; i < count; ++i) {
+            expected[i] += src[i] * multiplier;
+        }
+
+        dsp::multiplyAndAddSamples(dst.data(), src.data(), multiplier, count);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_FLOAT_EQ(dst[i], expected[i]);
+        }
+    }
+}
+
+TEST_F(Audio_SampleOpsTest, MultiplySamples)
+{
+    for (size_t count : SAMPLE_COUNTS) {
+        std::vector<float> buffer = makeSignal(count, 0.5f);
+        const float multiplier = 1.7f;
+
+        std::vector<float> expected = buffer;
+        for (size_t i = 0; i < count; ++i) {
+            expected[i] *= multiplier;
+        }
+
+        dsp::multiplySamples(buffer.data(), multiplier, count);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_FLOAT_EQ(buffer[i], expected[i]);
+        }
+    }
+}
+
+TEST_F(Audio_SampleOpsTest, MultiplyChannelsAndSumSquares)
+{
+    const gain_t gains[] = { 0.25f, 1.5f, 0.75f, 1.f, 2.f };
+
+    for (audioch_t channelsCount = 1; channelsCount <= 5; ++channelsCount) {
+        for (size_t samplesPerChannel : SAMPLE_COUNTS) {
+            std::vector<float> buffer = makeSignal(samplesPerChannel * channelsCount, 0.25f);
+
+            // [GIVEN] The results of the plain per-channel loop
+            std::vector<float> expectedBuffer = buffer;
+            std::vector<float> expectedSums(channelsCount, 0.f);
+
+            for (audioch_t ch = 0; ch < channelsCount; ++ch) {
+                for (size_t s = 0; s < samplesPerChannel; ++s) {
+                    float& sample = expectedBuffer[s * channelsCount + ch];
+                    sample *= gains[ch];
+                    expectedSums[ch] += sample * sample;
+                }
+            }
+
+            // [WHEN] Apply the gains using the vectorised kernel
+            std::vector<float> sums(channelsCount, -1.f);
+            dsp::multiplyChannelsAndSumSquares(buffer.data(), channelsCount, samplesPerChannel, gains, sums.data());
+
+            // [THEN] The samples are identical, the sums only differ by the order of additions
+            for (size_t i = 0; i < buffer.size(); ++i) {
+                EXPECT_FLOAT_EQ(buffer[i], expectedBuffer[i]);
+            }
+
+            for (audioch_t ch = 0; ch < channelsCount; ++ch) {
+                EXPECT_NEAR(sums[ch], expectedSums[ch], 1e-5f * std::max(1.f, expectedSums[ch]));
+            }
+        }
+    }
+}
@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "audio/internal/abstracteventsequencer.h"
+
+using namespace muse::audio;
+
+namespace muse::audio {
+class Audio_SortedEventListTest : public ::testing::Test
+{
+public:
+    using Event = std::variant<int, std::string>;
+    using EventList = SortedEventList<Event>;
+    using EventSequenceMap = std::map<msecs_t, std::set<Event> >;
+
+    struct TimedEvent {
+        msecs_t timestamp = 0;
+        Event event;
+    };
+
+    //! NOTE Fills both the list and the map that it replaces with the same events
+    static void fill(const std::vector<TimedEvent>& events, EventList& list, EventSequenceMap& map)
+    {
+        for (const TimedEvent& e : events) {
+            list.add(e.timestamp, e.event);
+            map[e.timestamp].insert(e.event);
+        }
+
+        list.sort();
+    }
+
+    static void expectSameEvents(const EventList& list, const EventSequenceMap& map)
+    {
+        size_t idx = 0;
+
+        for (const auto& pair : map) {
+            for (const Event& event : pair.second) {
+                ASSERT_LT(idx, list.size());
+                EXPECT_EQ(list.at(idx).timestamp, pair.first);
+                EXPECT_EQ(list.at(idx).event, event);
+                ++idx;
+            }
+        }
+
+        EXPECT_EQ(idx, list.size());
+    }
+
+    //! NOTE The index of the first event of map.lower_bound(timestamp) in the flattened map
+    static size_t mapLowerBound(const EventSequenceMap& map, msecs_t timestamp)
+    {
+        size_t idx = 0;
+
+        for (auto it = map.cbegin(); it != map.lower_bound(timestamp); ++it) {
+            idx += it->second.size();
+        }
+
+        return idx;
+    }
+};
+}
+
+TEST_F(Audio_SortedEventListTest, SameTimestamp)
+{
+    EventList list;
+    EventSequenceMap map;
+
+    //! [GIVEN] Several events at the same timestamp, added in no particular order
+    fill({ { 10, Event(3) }, { 10, Event(std::string("b")) }, { 0, Event(7) }, { 10, Event(1) }, { 10, Event(std::string("a")) } },
+         list, map);
+
+    //! [THEN] They are ordered within the timestamp like in the set
+    expectSameEvents(list, map);
+    EXPECT_EQ(list.size(), 5u);
+}
+
+TEST_F(Audio_SortedEventListTest, DuplicateEvents)
+{
+    EventList list;
+    EventSequenceMap map;
+
+    //! [GIVEN] The same events are added more than once
+    fill({ { 5, Event(1) }, { 5, Event(1) }, { 5, Event(2) }, { 0, Event(std::string("a")) }, { 0, Event(std::string("a")) },
+           { 5, Event(1) } }, list, map);
+
+    //! [THEN] The duplicates are dropped like in the set, the same event at another timestamp is kept
+    expectSameEvents(list, map);
+    EXPECT_EQ(list.size(), 3u);
+
+    //! [WHEN] An event of an existing timestamp is added to the sorted list
+    list.add(5, Event(2));
+    map[5].insert(Event(2));
+    list.sort();
+
+    //! [THEN] It is dropped as well
+    expectSameEvents(list, map);
+}
+
+TEST_F(Audio_SortedEventListTest, Removal)
+{
+    EventList list;
+    EventSequenceMap map;
+
+    fill({ { 1, Event(1) }, { 2, Event(2) } }, list, map);
+
+    //! [WHEN] The events are removed
+    list.clear();
+    map.clear();
+
+    //! [THEN] The list is empty like the map
+    EXPECT_TRUE(list.empty());
+    expectSameEvents(list, map);
+    EXPECT_EQ(list.lowerBound(0), 0u);
+
+    //! [WHEN] New events are added after the removal
+    fill({ { 3, Event(3) }, { 1, Event(1) } }, list, map);
+
+    //! [THEN] Only the new events are there
+    expectSameEvents(list, map);
+}
+
+TEST_F(Audio_SortedEventListTest, MatchesMapOfSets)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<msecs_t> timestampDist(0, 50);
+    std::uniform_int_distribution<int> valueDist(0, 10);
+
+    for (int round = 0; round < 20; ++round) {
+        std::vector<TimedEvent> events;
+
+        for (int i = 0; i < 200; ++i) {
+            int value = valueDist(gen);
+            Event event = value % 2 ? Event(value) : Event(std::to_string(value));
+            events.push_back({ timestampDist(gen), event });
+        }
+
+        EventList list;
+        EventSequenceMap map;
+        fill(events, list, map);
+
+        expectSameEvents(list, map);
+
+        for (msecs_t timestamp = -1; timestamp <= 52; ++timestamp) {
+            EXPECT_EQ(list.lowerBound(timestamp), mapLowerBound(map, timestamp));
+        }
+    }
+}
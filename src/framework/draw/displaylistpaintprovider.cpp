@@ -0,0 +1,261 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "displaylistpaintprovider.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::draw;
+
+using CommandType = DisplayList::CommandType;
+
+DisplayListPaintProvider::DisplayListPaintProvider()
+{
+    m_list = std::make_shared<DisplayList>();
+    m_states.push(State());
+}
+
+bool DisplayListPaintProvider::isActive() const
+{
+    return m_isActive;
+}
+
+void DisplayListPaintProvider::beginTarget(const std::string&)
+{
+    m_list = std::make_shared<DisplayList>();
+    m_states = std::stack<State>();
+    m_states.push(State());
+    m_isActive = true;
+}
+
+void DisplayListPaintProvider::beforeEndTargetHook(Painter*)
+{
+}
+
+bool DisplayListPaintProvider::endTarget(bool endDraw)
+{
+    UNUSED(endDraw);
+    m_isActive = false;
+    return true;
+}
+
+void DisplayListPaintProvider::addCommand(CommandType type, size_t index)
+{
+    m_list->commands.push_back(DisplayList::Command { type, index });
+}
+
+void DisplayListPaintProvider::beginObject(const std::string& name)
+{
+    m_list->names.push_back(name);
+    addCommand(CommandType::BeginObject, m_list->names.size() - 1);
+}
+
+void DisplayListPaintProvider::endObject()
+{
+    addCommand(CommandType::EndObject);
+}
+
+void DisplayListPaintProvider::setAntialiasing(bool arg)
+{
+    addCommand(CommandType::SetAntialiasing, arg ? 1 : 0);
+}
+
+void DisplayListPaintProvider::setCompositionMode(CompositionMode mode)
+{
+    addCommand(CommandType::SetCompositionMode, static_cast<size_t>(mode));
+}
+
+void DisplayListPaintProvider::setWindow(const RectF&)
+{
+    //! NOTE The window and the viewport belong to the device that the list is replayed on
+}
+
+void DisplayListPaintProvider::setViewport(const RectF&)
+{
+}
+
+void DisplayListPaintProvider::setFont(const Font& font)
+{
+    m_states.top().font = font;
+    m_list->fonts.push_back(font);
+    addCommand(CommandType::SetFont, m_list->fonts.size() - 1);
+}
+
+const Font& DisplayListPaintProvider::font() const
+{
+    return m_states.top().font;
+}
+
+void DisplayListPaintProvider::setPen(const Pen& pen)
+{
+    m_states.top().pen = pen;
+    m_list->pens.push_back(pen);
+    addCommand(CommandType::SetPen, m_list->pens.size() - 1);
+}
+
+void DisplayListPaintProvider::setNoPen()
+{
+    setPen(Pen(PenStyle::NoPen));
+}
+
+const Pen& DisplayListPaintProvider::pen() const
+{
+    return m_states.top().pen;
+}
+
+void DisplayListPaintProvider::setBrush(const Brush& brush)
+{
+    m_states.top().brush = brush;
+    m_list->brushes.push_back(brush);
+    addCommand(CommandType::SetBrush, m_list->brushes.size() - 1);
+}
+
+const Brush& DisplayListPaintProvider::brush() const
+{
+    return m_states.top().brush;
+}
+
+void DisplayListPaintProvider::save()
+{
+    m_states.push(m_states.top());
+    addCommand(CommandType::Save);
+}
+
+void DisplayListPaintProvider::restore()
+{
+    IF_ASSERT_FAILED(m_states.size() > 1) {
+        return;
+    }
+
+    m_states.pop();
+    addCommand(CommandType::Restore);
+}
+
+void DisplayListPaintProvider::setTransform(const Transform& transform)
+{
+    m_states.top().transform = transform;
+    m_list->transforms.push_back(transform);
+    addCommand(CommandType::SetTransform, m_list->transforms.size() - 1);
+}
+
+const Transform& DisplayListPaintProvider::transform() const
+{
+    return m_states.top().transform;
+}
+
+// drawing functions
+
+void DisplayListPaintProvider::drawPath(const PainterPath& path)
+{
+    m_list->paths.push_back(path);
+    addCommand(CommandType::DrawPath, m_list->paths.size() - 1);
+}
+
+void DisplayListPaintProvider::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
+{
+    PolygonF polygon(pointCount);
+    for (size_t i = 0; i < pointCount; ++i) {
+        polygon[i] = points[i];
+    }
+
+    m_list->polygons.push_back(DrawPolygon { polygon, mode });
+    addCommand(CommandType::DrawPolygon, m_list->polygons.size() - 1);
+}
+
+void DisplayListPaintProvider::drawText(const PointF& point, const String& text)
+{
+    m_list->texts.push_back(DrawText { DrawText::Point, RectF(point, SizeF()), 0, text });
+    addCommand(CommandType::DrawText, m_list->texts.size() - 1);
+}
+
+void DisplayListPaintProvider::drawText(const RectF& rect, int flags, const String& text)
+{
+    m_list->texts.push_back(DrawText { DrawText::Rect, rect, flags, text });
+    addCommand(CommandType::DrawText, m_list->texts.size() - 1);
+}
+
+void DisplayListPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
+{
+    m_list->textWorkarounds.push_back(DisplayList::TextWorkaround { f, pos, text });
+    addCommand(CommandType::DrawTextWorkaround, m_list->textWorkarounds.size() - 1);
+}
+
+void DisplayListPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
+{
+    m_list->symbols.push_back(DisplayList::Symbol { point, ucs4Code });
+    addCommand(CommandType::DrawSymbol, m_list->symbols.size() - 1);
+}
+
+void DisplayListPaintProvider::drawPixmap(const PointF& p, const Pixmap& pm)
+{
+    m_list->pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), pm, PointF() });
+    addCommand(CommandType::DrawPixmap, m_list->pixmaps.size() - 1);
+}
+
+void DisplayListPaintProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
+{
+    m_list->pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, pm, offset });
+    addCommand(CommandType::DrawPixmap, m_list->pixmaps.size() - 1);
+}
+
+#ifndef NO_QT_SUPPORT
+void DisplayListPaintProvider::drawPixmap(const PointF& p, const QPixmap& pm)
+{
+    drawPixmap(p, Pixmap::fromQPixmap(pm));
+}
+
+void DisplayListPaintProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
+{
+    drawTiledPixmap(rect, Pixmap::fromQPixmap(pm), offset);
+}
+
+#endif
+
+bool DisplayListPaintProvider::hasClipping() const
+{
+    return m_states.top().hasClipping;
+}
+
+void DisplayListPaintProvider::setClipRect(const RectF& rect)
+{
+    m_states.top().hasClipping = true;
+    m_list->rects.push_back(rect);
+    addCommand(CommandType::SetClipRect, m_list->rects.size() - 1);
+}
+
+void DisplayListPaintProvider::setMask(const RectF& background, const std::vector<RectF>& maskRects)
+{
+    m_states.top().hasClipping = !maskRects.empty();
+    m_list->masks.push_back(DisplayList::Mask { background, maskRects });
+    addCommand(CommandType::SetMask, m_list->masks.size() - 1);
+}
+
+void DisplayListPaintProvider::setClipping(bool enable)
+{
+    m_states.top().hasClipping = enable;
+    addCommand(CommandType::SetClipping, enable ? 1 : 0);
+}
+
+DisplayListPtr DisplayListPaintProvider::displayList() const
+{
+    return m_list;
+}
@@ -21,6 +21,7 @@
  */
 #include "fontfaceft.h"
 
+#include <mutex>
 #include <unordered_map>
 
 #include <ft2build.h>
@@ -94,6 +95,11 @@ struct muse::draw::FData
     std::unordered_map<glyph_idx_t, GlyphMetrics> glyphsMetrics;
     std::unordered_map<glyph_idx_t, SymbolMetrics> symbolMetrics;
     FT_Size_Metrics metrics;
+
+    //! NOTE A FreeType face (and the HarfBuzz font on top of it) must not be used from several threads at once,
+    //! and the caches above are filled lazily, so every access to them is serialized.
+    //! Recursive, because the public methods call each other (e.g. glyphs() -> symbolMetrics())
+    std::recursive_mutex mutex;
 };
 
 FontFaceFT::FontFaceFT()
@@ -171,6 +177,8 @@ std::vector<GlyphPos> FontFaceFT::glyphs(const char32_t* text, int text_length)
         return std::vector<GlyphPos>();
     }
 
+    std::lock_guard lock(m_data->mutex);
+
     std::vector<GlyphPos> result;
     if (m_isSymbolMode) {
         for (int i = 0; i < text_length; ++i) {
@@ -220,18 +228,22 @@ glyph_idx_t FontFaceFT::glyphIndex(char32_t ucs4) const
         return 0;
     }
 
+    std::lock_guard lock(m_data->mutex);
     FT_UInt index = FT_Get_Char_Index(m_data->face, ucs4);
     return static_cast<glyph_idx_t>(index);
 }
 
 glyph_idx_t FontFaceFT::glyphIndex(const std::string& glyphName) const
 {
+    std::lock_guard lock(m_data->mutex);
     FT_UInt index = FT_Get_Name_Index(m_data->face, glyphName.c_str());
     return static_cast<glyph_idx_t>(index);
 }
 
 char32_t FontFaceFT::findCharCode(glyph_idx_t idx) const
 {
+    std::lock_guard lock(m_data->mutex);
+
     auto findC = [this](glyph_idx_t idx)
     {
         FT_UInt gindex = 0;
@@ -313,6 +325,9 @@ const msdfgen::Shape& FontFaceFT::glyphShape(glyph_idx_t idx) const
         return null;
     }
 
+    std::lock_guard lock(m_data->mutex);
+
+    //! NOTE The references to the elements of an unordered_map stay valid when it grows
     auto it = m_cache.find(idx);
     if (it != m_cache.end()) {
         return it->second;
@@ -354,6 +369,8 @@ f26dot6_t FontFaceFT::descent() const
 
 f26dot6_t FontFaceFT::xHeight() const
 {
+    std::lock_guard lock(m_data->mutex);
+
     TT_OS2* os2 = (TT_OS2*)FT_Get_Sfnt_Table(m_data->face, ft_sfnt_os2);
     if (os2 && os2->sxHeight) {
         f26dot6_t result = std::round(os2->sxHeight * m_data->face->size->metrics.y_ppem * 64.0 / (double)m_data->face->units_per_EM);
@@ -370,6 +387,8 @@ f26dot6_t FontFaceFT::xHeight() const
 
 f26dot6_t FontFaceFT::capHeight() const
 {
+    std::lock_guard lock(m_data->mutex);
+
     TT_OS2* os2 = (TT_OS2*)FT_Get_Sfnt_Table(m_data->face, ft_sfnt_os2);
     if (os2 && os2->sCapHeight) {
         f26dot6_t result = std::round(os2->sCapHeight * m_data->face->size->metrics.y_ppem * 64.0 / (double)m_data->face->units_per_EM);
@@ -386,6 +405,8 @@ f26dot6_t FontFaceFT::capHeight() const
 
 GlyphMetrics* FontFaceFT::glyphMetrics(glyph_idx_t idx) const
 {
+    std::lock_guard lock(m_data->mutex);
+
     if (m_data->glyphsMetrics.find(idx) != m_data->glyphsMetrics.end()) {
         return &m_data->glyphsMetrics.at(idx);
     }
@@ -415,6 +436,8 @@ GlyphMetrics* FontFaceFT::glyphMetrics(glyph_idx_t idx) const
 
 SymbolMetrics* FontFaceFT::symbolMetrics(glyph_idx_t idx) const
 {
+    std::lock_guard lock(m_data->mutex);
+
     if (m_data->symbolMetrics.find(idx) != m_data->symbolMetrics.end()) {
         return &m_data->symbolMetrics.at(idx);
     }
@@ -181,10 +181,13 @@ double FontsEngine::horizontalAdvance(const Font& f, const std::u32string& text)
         return 0.0;
     }
 
-    std::vector<GlyphPos> glyphs = rf->face->glyphs(&text[0], (int)text.size());
     f26dot6_t advance = 0;
-    for (const GlyphPos& g : glyphs) {
-        advance += g.x_advance;
+    if (!m_advanceCache.get(rf, text, advance)) {
+        std::vector<GlyphPos> glyphs = rf->face->glyphs(&text[0], (int)text.size());
+        for (const GlyphPos& g : glyphs) {
+            advance += g.x_advance;
+        }
+        m_advanceCache.put(rf, text, advance);
     }
 
     return from_f26d6(advance) * rf->pixelScale();
@@ -217,26 +220,13 @@ RectF FontsEngine::boundingRect(const Font& f, const std::u32string& text) const
     bool isFirstLine = true;
     bool isFirstInLine = true;
 
-    std::vector<TextBlock> lines = splitTextByLines(text);
-    for (const TextBlock& l : lines) {
+    ShapedTextPtr shaped = shapedText(rf, text);
+    for (const std::vector<ShapedRun>& line : shaped->lines) {
         lineRect = FBBox();
         isFirstInLine = true;
 
-        std::vector<TextBlock> fontFaceBlocks = splitTextByFontFaces(rf, l);
-        for (const TextBlock& ffBlock : fontFaceBlocks) {
-            const IFontFace* fontFace = nullptr;
-            if (rf->face->glyphIndex(*ffBlock.text) != 0) {
-                fontFace = rf->face;
-            } else {
-                fontFace = findSubtitutionFont(*ffBlock.text, rf->subtitutionFaces);
-            }
-            if (!fontFace) {
-                continue;
-            }
-
-            std::vector<GlyphPos> glyphs = fontFace->glyphs(ffBlock.text, ffBlock.lenght);
-
-            for (const GlyphPos& g : glyphs) {
+        for (const ShapedRun& run : line) {
+            for (const GlyphPos& g : run.glyphs) {
                 FBBox bbox = rf->face->glyphBbox(g.idx);
                 if (isFirstInLine) {
                     lineRect = bbox;
@@ -278,29 +268,19 @@ RectF FontsEngine::tightBoundingRect(const Font& f, const std::u32string& text)
     bool isFirstLine = true;
     bool isFirstInLine = true;
 
-    std::vector<TextBlock> lines = splitTextByLines(text);
-    for (const TextBlock& l : lines) {
+    ShapedTextPtr shaped = shapedText(rf, text);
+    for (const std::vector<ShapedRun>& line : shaped->lines) {
         lineRect = FBBox();
         isFirstInLine = true;
         f26dot6_t advance = 0;
 
-        std::vector<TextBlock> fontFaceBlocks = splitTextByFontFaces(rf, l);
-
         GlyphPos lastGlyph;
-        for (const TextBlock& ffBlock : fontFaceBlocks) {
-            const IFontFace* fontFace = nullptr;
-            if (rf->face->glyphIndex(*ffBlock.text) != 0) {
-                fontFace = rf->face;
-            } else {
-                fontFace = findSubtitutionFont(*ffBlock.text, rf->subtitutionFaces);
-            }
-            if (!fontFace) {
+        for (const ShapedRun& run : line) {
+            if (run.glyphs.empty()) {
                 continue;
             }
 
-            std::vector<GlyphPos> glyphs = fontFace->glyphs(ffBlock.text, ffBlock.lenght);
-
-            for (const GlyphPos& g : glyphs) {
+            for (const GlyphPos& g : run.glyphs) {
                 FBBox bbox = rf->face->glyphBbox(g.idx);
                 if (isFirstInLine) {
                     lineRect = bbox;
@@ -313,7 +293,7 @@ RectF FontsEngine::tightBoundingRect(const Font& f, const std::u32string& text)
                 }
                 advance += g.x_advance;
             }
-            lastGlyph = glyphs.back();
+            lastGlyph = run.glyphs.back();
         }
 
         advance -= (lastGlyph.x_advance - rf->face->glyphBbox(lastGlyph.idx).width());
@@ -444,25 +424,13 @@ std::vector<GlyphImage> FontsEngine::render(const Font& f, const std::u32string&
     double pixelScale = rf->pixelScale();
     double glyphTop = 0;
 
-    std::vector<TextBlock> lines = splitTextByLines(text);
-    for (const TextBlock& l : lines) {
+    ShapedTextPtr shaped = shapedText(rf, text);
+    for (const std::vector<ShapedRun>& line : shaped->lines) {
         double glyphLeft = 0;
 
-        std::vector<TextBlock> fontFaceBlocks = splitTextByFontFaces(rf, l);
-        for (const TextBlock& ffBlock : fontFaceBlocks) {
-            const IFontFace* fontFace = nullptr;
-            if (rf->face->glyphIndex(*ffBlock.text) != 0) {
-                fontFace = rf->face;
-            } else {
-                fontFace = findSubtitutionFont(*ffBlock.text, rf->subtitutionFaces);
-            }
-            if (!fontFace) {
-                continue;
-            }
-
-            std::vector<GlyphPos> glyphs = fontFace->glyphs(ffBlock.text, ffBlock.lenght);
-
-            for (const GlyphPos& g : glyphs) {
+        for (const ShapedRun& run : line) {
+            const IFontFace* fontFace = run.face;
+            for (const GlyphPos& g : run.glyphs) {
                 if (NOT_RENDER_GLYPHS.find(g.idx) == NOT_RENDER_GLYPHS.end()) {
                     GlyphImage image;// = m_renderCache.load(fontFace->key(), g.idx);
                     if (image.isNull()) {
@@ -530,6 +498,9 @@ FontsEngine::RequireFace* FontsEngine::fontFace(const Font& f, bool isSymbolMode
         requireKey.type = Font::Type::Text;
     }
 
+    //! NOTE Text is measured from the layout and the export threads as well
+    std::lock_guard lock(m_facesMutex);
+
     //! NOTE We are looking for the require font we need among the previously loaded ones
     for (RequireFace* face : m_requiredFaces) {
         if (face->requireKey == requireKey && face->isSymbolMode() == isSymbolMode) {
@@ -675,3 +646,37 @@ std::vector<FontsEngine::TextBlock> FontsEngine::splitTextByFontFaces(const Requ
 
     return textBlocks;
 }
+
+FontsEngine::ShapedTextPtr FontsEngine::shapedText(const RequireFace* rf, const std::u32string& text) const
+{
+    ShapedTextPtr shaped;
+    if (m_shapedTextCache.get(rf, text, shaped)) {
+        return shaped;
+    }
+
+    std::shared_ptr<ShapedText> newShaped = std::make_shared<ShapedText>();
+
+    std::vector<TextBlock> lines = splitTextByLines(text);
+    for (const TextBlock& l : lines) {
+        std::vector<ShapedRun>& line = newShaped->lines.emplace_back();
+
+        std::vector<TextBlock> fontFaceBlocks = splitTextByFontFaces(rf, l);
+        for (const TextBlock& ffBlock : fontFaceBlocks) {
+            const IFontFace* fontFace = nullptr;
+            if (rf->face->glyphIndex(*ffBlock.text) != 0) {
+                fontFace = rf->face;
+            } else {
+                fontFace = findSubtitutionFont(*ffBlock.text, rf->subtitutionFaces);
+            }
+            if (!fontFace) {
+                continue;
+            }
+
+            line.push_back(ShapedRun { fontFace, fontFace->glyphs(ffBlock.text, ffBlock.lenght) });
+        }
+    }
+
+    m_shapedTextCache.put(rf, text, newShaped);
+
+    return newShaped;
+}
@@ -23,16 +23,19 @@
 
 #include <vector>
 #include <functional>
+#include <memory>
+#include <mutex>
 
 #include "ifontsengine.h"
 
 #include "global/modularity/ioc.h"
 #include "ifontsdatabase.h"
+#include "ifontface.h"
+#include "textcache.h"
 
 //#include "fontrendercache.h"
 
 namespace muse::draw {
-class IFontFace;
 class FontsEngine : public IFontsEngine, public Injectable
 {
     Inject<IFontsDatabase> fontsDatabase = { this };
@@ -87,17 +90,36 @@ private:
         double pixelScale() const;
     };
 
+    //! NOTE Glyphs of a piece of a line that is shaped with one face (the required one or a substitution)
+    struct ShapedRun {
+        const IFontFace* face = nullptr;
+        std::vector<GlyphPos> glyphs;
+    };
+
+    struct ShapedText {
+        std::vector<std::vector<ShapedRun> > lines;
+    };
+
+    using ShapedTextPtr = std::shared_ptr<const ShapedText>;
+
     IFontFace* createFontFace(const io::path_t& path) const;
     RequireFace* fontFace(const Font& f, bool isSymbolMode = false) const;
 
     std::vector<TextBlock> splitTextByLines(const std::u32string& text) const;
     std::vector<TextBlock> splitTextByFontFaces(const RequireFace* rf, const TextBlock& text) const;
 
+    ShapedTextPtr shapedText(const RequireFace* rf, const std::u32string& text) const;
+
     FontFaceFactory m_fontFaceFactory;
 
+    mutable std::mutex m_facesMutex;
     mutable std::vector<IFontFace*> m_loadedFaces;
     mutable std::vector<RequireFace*> m_requiredFaces;
 
+    //! NOTE Keyed by the required face, so by the font, its size and the mode
+    mutable TextCache<f26dot6_t> m_advanceCache { 4096 };
+    mutable TextCache<ShapedTextPtr> m_shapedTextCache { 4096 };
+
     //mutable FontRenderCache m_renderCache;
 };
 }
@@ -21,6 +21,7 @@
  */
 #include "qpainterprovider.h"
 
+#include <QCoreApplication>
 #include <QPainter>
 #include <QRawFont>
 #include <QTextLayout>
@@ -29,6 +30,7 @@
 #include <QPixmapCache>
 #include <QStaticText>
 #include <QPainterPath>
+#include <QThread>
 
 #include "draw/utils/drawlogger.h"
 #include "types/transform.h"
@@ -38,6 +40,14 @@
 
 using namespace muse::draw;
 
+//! NOTE QPixmap and QPixmapCache may only be used in the GUI thread,
+//! other threads (e.g. exporting parts concurrently) draw the pixmaps as images
+static bool isGuiThread()
+{
+    const QCoreApplication* app = QCoreApplication::instance();
+    return app && QThread::currentThread() == app->thread();
+}
+
 QPainterProvider::QPainterProvider(QPainter* painter, bool ownsPainter)
     : m_painter(painter), m_ownsPainter(ownsPainter), m_drawObjectsLogger(new DrawObjectsLogger())
 {
@@ -305,7 +315,7 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
 
 void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    static QHash<char32_t, QString> cache;
+    thread_local QHash<char32_t, QString> cache;
     if (!cache.contains(ucs4Code)) {
         cache[ucs4Code] = QString::fromUcs4(&ucs4Code, 1);
     }
@@ -315,6 +325,13 @@ void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 
 void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 {
+    if (!isGuiThread()) {
+        QImage image;
+        image.loadFromData(pm.data().toQByteArrayNoCopy());
+        m_painter->drawImage(QPointF(point.x(), point.y()), image);
+        return;
+    }
+
     QString key = QString::number(pm.key());
     QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
@@ -327,6 +344,18 @@ void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 
 void QPainterProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
 {
+    if (!isGuiThread()) {
+        QImage image;
+        image.loadFromData(pm.data().toQByteArrayNoCopy());
+
+        //! NOTE Same as drawTiledPixmap: the tiles start at the top left of the rect, shifted by the offset
+        const QPointF oldOrigin = m_painter->brushOrigin();
+        m_painter->setBrushOrigin(rect.toQRectF().topLeft() - QPointF(offset.x(), offset.y()));
+        m_painter->fillRect(rect.toQRectF(), QBrush(image));
+        m_painter->setBrushOrigin(oldOrigin);
+        return;
+    }
+
     QString key = QString::number(pm.key());
     QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
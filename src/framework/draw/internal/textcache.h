@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace muse::draw {
+//! NOTE Thread-safe cache of a bounded size for the results of text processing (shaping, measuring),
+//! keyed by the face the text is processed with and the text itself.
+//! When the cache is full, the least recently used entry is dropped.
+template<typename Value>
+class TextCache
+{
+public:
+    explicit TextCache(size_t capacity)
+        : m_capacity(capacity) {}
+
+    bool get(const void* face, const std::u32string& text, Value& out)
+    {
+        const size_t h = hash(face, text);
+
+        std::lock_guard lock(m_mutex);
+
+        auto range = m_index.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            const Entry& e = *it->second;
+            if (e.face == face && e.text == text) {
+                //! NOTE Move to the front, as the most recently used
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                out = e.value;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void put(const void* face, const std::u32string& text, const Value& value)
+    {
+        const size_t h = hash(face, text);
+
+        std::lock_guard lock(m_mutex);
+
+        //! NOTE Another thread may have put it meanwhile
+        auto range = m_index.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            const Entry& e = *it->second;
+            if (e.face == face && e.text == text) {
+                return;
+            }
+        }
+
+        m_entries.push_front(Entry { face, text, h, value });
+        m_index.emplace(h, m_entries.begin());
+
+        if (m_entries.size() > m_capacity) {
+            removeEntry(std::prev(m_entries.end()));
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard lock(m_mutex);
+        m_entries.clear();
+        m_index.clear();
+    }
+
+    size_t size() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_entries.size();
+    }
+
+private:
+    struct Entry {
+        const void* face = nullptr;
+        std::u32string text;
+        size_t hash = 0;
+        Value value;
+    };
+
+    using EntryIt = typename std::list<Entry>::iterator;
+
+    static size_t hash(const void* face, const std::u32string& text)
+    {
+        size_t h = std::hash<std::u32string> {}(text);
+        return h ^ (std::hash<const void*> {}(face) + 0x9e3779b9 + (h << 6) + (h >> 2));
+    }
+
+    void removeEntry(EntryIt entryIt)
+    {
+        auto range = m_index.equal_range(entryIt->hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == entryIt) {
+                m_index.erase(it);
+                break;
+            }
+        }
+        m_entries.erase(entryIt);
+    }
+
+    mutable std::mutex m_mutex;
+    std::list<Entry> m_entries; // the most recently used first
+    std::unordered_multimap<size_t, EntryIt> m_index;
+    size_t m_capacity = 0;
+};
+}
@@ -0,0 +1,184 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#ifndef NO_QT_SUPPORT
+#include <QPainter>
+#include <QImage>
+#endif
+
+#include "draw/painter.h"
+#include "draw/displaylistpaintprovider.h"
+#include "draw/utils/displaylistpaint.h"
+
+using namespace muse;
+using namespace muse::draw;
+
+class Draw_DisplayListTests : public ::testing::Test
+{
+public:
+};
+
+static void paintSample(Painter& painter)
+{
+    painter.setAntialiasing(true);
+
+    painter.setPen(Pen(Color(255, 0, 0), 2.0));
+    painter.setBrush(Brush(Color(0, 0, 255)));
+    painter.drawRect(RectF(5.0, 5.0, 20.0, 10.0));
+
+    painter.save();
+    painter.translate(30.0, 20.0);
+    painter.setClipRect(RectF(0.0, 0.0, 15.0, 15.0));
+    painter.setBrush(Brush(Color(0, 255, 0)));
+    painter.drawEllipse(RectF(0.0, 0.0, 30.0, 30.0));
+    painter.restore();
+
+    painter.setPen(Pen(Color(0, 0, 0), 1.0));
+    painter.drawLine(LineF(0.0, 60.0, 60.0, 0.0));
+}
+
+#ifndef NO_QT_SUPPORT
+TEST_F(Draw_DisplayListTests, Replay_SameAsDirectPainting)
+{
+    //! GIVEN Painting directly on an image, with a transform
+    QImage expected(80, 80, QImage::Format_ARGB32_Premultiplied);
+    expected.fill(Qt::white);
+    {
+        QPainter qp(&expected);
+        Painter painter(&qp, "direct");
+        painter.translate(10.0, 5.0);
+        painter.scale(0.9, 0.9);
+        paintSample(painter);
+    }
+
+    //! DO Record the same painting
+    auto recorder = std::make_shared<DisplayListPaintProvider>();
+    {
+        Painter painter(recorder, "record");
+        paintSample(painter);
+    }
+
+    DisplayListPtr list = recorder->displayList();
+    ASSERT_TRUE(list);
+    EXPECT_FALSE(list->empty());
+
+    //! DO Replay it on another image, with the same transform
+    QImage replayed(80, 80, QImage::Format_ARGB32_Premultiplied);
+    replayed.fill(Qt::white);
+    {
+        QPainter qp(&replayed);
+        Painter painter(&qp, "replay");
+        painter.translate(10.0, 5.0);
+        painter.scale(0.9, 0.9);
+        DisplayListPaint::paint(&painter, *list);
+
+        //! CHECK The state of the painter is restored
+        Transform expectedTransform;
+        expectedTransform.translate(10.0, 5.0);
+        expectedTransform.scale(0.9, 0.9);
+        EXPECT_EQ(painter.worldTransform(), expectedTransform);
+    }
+
+    //! CHECK The result is identical
+    EXPECT_EQ(replayed, expected);
+}
+
+#endif
+
+TEST_F(Draw_DisplayListTests, Replay_OnTopOfPainterTransform)
+{
+    //! GIVEN Recorded painting
+    auto recorder = std::make_shared<DisplayListPaintProvider>();
+    {
+        Painter painter(recorder, "record");
+        paintSample(painter);
+    }
+
+    DisplayListPtr list = recorder->displayList();
+    ASSERT_TRUE(list);
+
+    //! DO Replay it on a painter with a transform, recording the replay
+    Transform baseTransform;
+    baseTransform.translate(10.0, 5.0);
+    baseTransform.scale(0.9, 0.9);
+
+    auto replayRecorder = std::make_shared<DisplayListPaintProvider>();
+    {
+        Painter painter(replayRecorder, "replay");
+        painter.setWorldTransform(baseTransform);
+        DisplayListPaint::paint(&painter, *list);
+
+        //! CHECK The state of the painter is restored
+        EXPECT_EQ(painter.worldTransform(), baseTransform);
+    }
+
+    DisplayListPtr replayed = replayRecorder->displayList();
+    ASSERT_TRUE(replayed);
+
+    //! CHECK The same primitives are drawn with the same pens and brushes
+    EXPECT_EQ(replayed->paths.size(), list->paths.size());
+    EXPECT_EQ(replayed->polygons.size(), list->polygons.size());
+    EXPECT_EQ(replayed->rects, list->rects);
+    EXPECT_EQ(replayed->pens, list->pens);
+    EXPECT_EQ(replayed->brushes, list->brushes);
+
+    //! CHECK The recorded transforms are applied on top of the painter's one
+    ASSERT_FALSE(list->transforms.empty());
+    ASSERT_FALSE(replayed->transforms.empty());
+    EXPECT_EQ(replayed->transforms.front(), baseTransform);
+    for (const Transform& transform : list->transforms) {
+        EXPECT_TRUE(muse::contains(replayed->transforms, transform * baseTransform));
+    }
+}
+
+TEST_F(Draw_DisplayListTests, Record_TracksState)
+{
+    //! GIVEN Recording painter
+    auto recorder = std::make_shared<DisplayListPaintProvider>();
+    Painter painter(recorder, "record");
+
+    //! DO Change the state and save/restore it
+    painter.setPen(Pen(Color(255, 0, 0), 3.0));
+    painter.save();
+    painter.setPen(Pen(Color(0, 255, 0), 1.0));
+    painter.setClipRect(RectF(0.0, 0.0, 10.0, 10.0));
+
+    //! CHECK The state is available to the painting code
+    EXPECT_EQ(painter.pen().color(), Color(0, 255, 0));
+    EXPECT_TRUE(painter.hasClipping());
+
+    painter.restore();
+
+    EXPECT_EQ(painter.pen().color(), Color(255, 0, 0));
+    EXPECT_FALSE(painter.hasClipping());
+
+    //! CHECK The commands are recorded in order
+    DisplayListPtr list = recorder->displayList();
+    ASSERT_EQ(list->commands.size(), 5u);
+    EXPECT_EQ(list->commands[0].type, DisplayList::CommandType::SetPen);
+    EXPECT_EQ(list->commands[1].type, DisplayList::CommandType::Save);
+    EXPECT_EQ(list->commands[2].type, DisplayList::CommandType::SetPen);
+    EXPECT_EQ(list->commands[3].type, DisplayList::CommandType::SetClipRect);
+    EXPECT_EQ(list->commands[4].type, DisplayList::CommandType::Restore);
+}
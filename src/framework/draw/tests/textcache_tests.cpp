@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "draw/internal/textcache.h"
+
+using namespace muse;
+using namespace muse::draw;
+
+class Draw_TextCacheTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Draw_TextCacheTests, GetPut)
+{
+    TextCache<int> cache(4);
+
+    int face1 = 0;
+    int face2 = 0;
+
+    int value = 0;
+    EXPECT_FALSE(cache.get(&face1, U"text", value));
+
+    cache.put(&face1, U"text", 1);
+    cache.put(&face2, U"text", 2);
+    cache.put(&face1, U"other", 3);
+
+    //! NOTE The same text with another face is another entry
+    EXPECT_TRUE(cache.get(&face1, U"text", value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(cache.get(&face2, U"text", value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(cache.get(&face1, U"other", value));
+    EXPECT_EQ(value, 3);
+
+    EXPECT_EQ(cache.size(), 3u);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_FALSE(cache.get(&face1, U"text", value));
+}
+
+TEST_F(Draw_TextCacheTests, DropLeastRecentlyUsed)
+{
+    TextCache<int> cache(2);
+
+    int face = 0;
+    int value = 0;
+
+    cache.put(&face, U"a", 1);
+    cache.put(&face, U"b", 2);
+
+    //! NOTE Touch "a", so "b" becomes the least recently used
+    EXPECT_TRUE(cache.get(&face, U"a", value));
+
+    cache.put(&face, U"c", 3);
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_TRUE(cache.get(&face, U"a", value));
+    EXPECT_FALSE(cache.get(&face, U"b", value));
+    EXPECT_TRUE(cache.get(&face, U"c", value));
+    EXPECT_EQ(value, 3);
+}
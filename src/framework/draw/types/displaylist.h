@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_DRAW_DISPLAYLIST_H
+#define MUSE_DRAW_DISPLAYLIST_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "drawdata.h"
+
+namespace muse::draw {
+//! NOTE Paint commands in the order they were issued, to be replayed on any painter.
+//! Unlike DrawData (which groups primitives by their type for diagnostics),
+//! it keeps the exact order, save/restore and clipping, so the replay is identical to the original painting.
+//! The arguments of the commands are kept in pools by type, a command only refers to its arguments by index.
+struct DisplayList
+{
+    enum class CommandType : unsigned char {
+        BeginObject = 0,        // names
+        EndObject,
+        SetAntialiasing,        // index is the value
+        SetCompositionMode,     // index is the value
+        SetFont,                // fonts
+        SetPen,                 // pens
+        SetBrush,               // brushes
+        SetTransform,           // transforms
+        Save,
+        Restore,
+        SetClipRect,            // rects
+        SetMask,                // masks
+        SetClipping,            // index is the value
+        DrawPath,               // paths
+        DrawPolygon,            // polygons
+        DrawText,               // texts
+        DrawTextWorkaround,     // textWorkarounds
+        DrawSymbol,             // symbols
+        DrawPixmap              // pixmaps
+    };
+
+    struct Command {
+        CommandType type = CommandType::EndObject;
+        size_t index = 0;
+    };
+
+    struct Mask {
+        RectF background;
+        std::vector<RectF> maskRects;
+    };
+
+    struct TextWorkaround {
+        Font font;
+        PointF pos;
+        String text;
+    };
+
+    struct Symbol {
+        PointF point;
+        char32_t code = 0;
+    };
+
+    std::vector<Command> commands;
+
+    std::vector<std::string> names;
+    std::vector<Font> fonts;
+    std::vector<Pen> pens;
+    std::vector<Brush> brushes;
+    std::vector<Transform> transforms;
+    std::vector<RectF> rects;
+    std::vector<Mask> masks;
+    std::vector<PainterPath> paths;
+    std::vector<DrawPolygon> polygons;
+    std::vector<DrawText> texts;
+    std::vector<TextWorkaround> textWorkarounds;
+    std::vector<Symbol> symbols;
+    std::vector<DrawPixmap> pixmaps;
+
+    bool empty() const { return commands.empty(); }
+};
+
+using DisplayListPtr = std::shared_ptr<const DisplayList>;
+}
+
+#endif // MUSE_DRAW_DISPLAYLIST_H
@@ -0,0 +1,119 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "displaylistpaint.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::draw;
+
+void DisplayListPaint::paint(Painter* painter, const DisplayList& list)
+{
+    TRACEFUNC;
+
+    using CommandType = DisplayList::CommandType;
+
+    const Transform baseTransform = painter->worldTransform();
+    IPaintProviderPtr provider = painter->provider();
+
+    painter->save();
+
+    for (const DisplayList::Command& cmd : list.commands) {
+        switch (cmd.type) {
+        case CommandType::BeginObject:
+            painter->beginObject(list.names[cmd.index]);
+            break;
+        case CommandType::EndObject:
+            painter->endObject();
+            break;
+        case CommandType::SetAntialiasing:
+            painter->setAntialiasing(cmd.index != 0);
+            break;
+        case CommandType::SetCompositionMode:
+            painter->setCompositionMode(static_cast<CompositionMode>(cmd.index));
+            break;
+        case CommandType::SetFont:
+            painter->setFont(list.fonts[cmd.index]);
+            break;
+        case CommandType::SetPen:
+            painter->setPen(list.pens[cmd.index]);
+            break;
+        case CommandType::SetBrush:
+            painter->setBrush(list.brushes[cmd.index]);
+            break;
+        case CommandType::SetTransform:
+            painter->setWorldTransform(list.transforms[cmd.index] * baseTransform);
+            break;
+        case CommandType::Save:
+            painter->save();
+            break;
+        case CommandType::Restore:
+            painter->restore();
+            break;
+        case CommandType::SetClipRect:
+            painter->setClipRect(list.rects[cmd.index]);
+            break;
+        case CommandType::SetMask: {
+            const DisplayList::Mask& mask = list.masks[cmd.index];
+            painter->setMask(mask.background, mask.maskRects);
+        } break;
+        case CommandType::SetClipping:
+            painter->setClipping(cmd.index != 0);
+            break;
+        case CommandType::DrawPath:
+            painter->drawPath(list.paths[cmd.index]);
+            break;
+        case CommandType::DrawPolygon: {
+            const DrawPolygon& pl = list.polygons[cmd.index];
+            if (!pl.polygon.empty()) {
+                provider->drawPolygon(&pl.polygon[0], pl.polygon.size(), pl.mode);
+            }
+        } break;
+        case CommandType::DrawText: {
+            const DrawText& t = list.texts[cmd.index];
+            if (t.mode == DrawText::Point) {
+                painter->drawText(t.rect.topLeft(), t.text);
+            } else {
+                painter->drawText(t.rect, t.flags, t.text);
+            }
+        } break;
+        case CommandType::DrawTextWorkaround: {
+            const DisplayList::TextWorkaround& t = list.textWorkarounds[cmd.index];
+            provider->drawTextWorkaround(t.font, t.pos, t.text);
+        } break;
+        case CommandType::DrawSymbol: {
+            const DisplayList::Symbol& s = list.symbols[cmd.index];
+            painter->drawSymbol(s.point, s.code);
+        } break;
+        case CommandType::DrawPixmap: {
+            const DrawPixmap& px = list.pixmaps[cmd.index];
+            if (px.mode == DrawPixmap::Single) {
+                painter->drawPixmap(px.rect.topLeft(), px.pm);
+            } else {
+                painter->drawTiledPixmap(px.rect, px.pm, px.offset);
+            }
+        } break;
+        }
+    }
+
+    painter->restore();
+}
@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_DRAW_DISPLAYLISTPAINT_H
+#define MUSE_DRAW_DISPLAYLISTPAINT_H
+
+#include "../painter.h"
+#include "../types/displaylist.h"
+
+namespace muse::draw {
+class DisplayListPaint
+{
+public:
+    DisplayListPaint() = default;
+
+    //! NOTE The recorded transforms are applied on top of the current world transform of the painter.
+    //! The state of the painter is restored after the replay
+    static void paint(Painter* painter, const DisplayList& list);
+};
+}
+
+#endif // MUSE_DRAW_DISPLAYLISTPAINT_H
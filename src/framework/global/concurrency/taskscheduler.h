@@ -23,12 +23,15 @@
 #ifndef MUSE_GLOBAL_TASKCHEDULER_H
 #define MUSE_GLOBAL_TASKCHEDULER_H
 
+#include <chrono>
 #include <condition_variable>
+#include <exception>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <atomic>
+#include <algorithm>
 #include <queue>
 #include <thread>
 #include <type_traits>
@@ -43,6 +46,12 @@ typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread
 class TaskScheduler
 {
 public:
+    struct Metrics {
+        uint64_t tasksExecuted = 0;
+        std::chrono::microseconds queueWaitTime { 0 }; // total time the tasks spent in the queue
+        std::chrono::microseconds runTime { 0 };       // total time the tasks were running
+    };
+
     explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
         : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount)),
         m_threadPool(std::make_unique<std::thread[]>(vaildateThreadPoolCapacity(desiredThreadCount)))
@@ -89,17 +98,72 @@ public:
         std::function<void()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
         {
             const std::lock_guard lock(m_mutex);
-            m_taskQueue.push(taskFunctor);
+            m_taskQueue.push(Task { std::move(taskFunctor), Clock::now() });
         }
         m_newTaskAvailableCv.notify_one();
     }
 
+    //! NOTE Calls func(i) for every i in [0, count) and returns when all calls are done.
+    //! The calling thread takes part in the work, the indexes are handed out one by one,
+    //! so uneven work is balanced between the threads.
+    //! The job is published in a slot preallocated by the scheduler, so the calling thread doesn't lock
+    //! a mutex or allocate: it wakes the idle workers, works itself and then spins until the workers
+    //! that have joined the job are done. This makes it usable on the real-time threads (e.g. audio).
+    //! If another thread is running a parallelFor on the same scheduler, the job goes through the task queue.
+    //! Must not be called from a task of the same scheduler
+    template<typename FuncT>
+    void parallelFor(size_t count, FuncT&& func)
+    {
+        if (count == 0) {
+            return;
+        }
+
+        if (count == 1) {
+            func(size_t(0));
+            return;
+        }
+
+        using Func = std::remove_reference_t<FuncT>;
+
+        bool isBusy = false;
+        if (!m_forkJoin.isBusy.compare_exchange_strong(isBusy, true)) {
+            parallelForQueued<Func>(count, func);
+            return;
+        }
+
+        m_forkJoin.count = count;
+        m_forkJoin.func = const_cast<void*>(static_cast<const void*>(&func));
+        m_forkJoin.invoke = [](void* f, size_t idx) { (*static_cast<Func*>(f))(idx); };
+        m_forkJoin.next = 0;
+        m_forkJoin.hasException = false;
+
+        m_forkJoin.isOpen = true;
+        ++m_forkJoin.generation;
+        m_newTaskAvailableCv.notify_all();
+
+        m_forkJoin.run();
+
+        // no worker can join after the slot is closed, so waiting for the ones that have joined is enough
+        m_forkJoin.isOpen = false;
+        while (m_forkJoin.activeHelpers != 0) {
+            std::this_thread::yield();
+        }
+
+        std::exception_ptr exception = std::move(m_forkJoin.exception);
+        m_forkJoin.exception = nullptr;
+        m_forkJoin.isBusy = false;
+
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
     template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
     std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
     {
         std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
         std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
-        push([taskFunctor, promise] {
+        push([taskFunctor = std::move(taskFunctor), promise] {
             try {
                 if constexpr (std::is_void_v<ReturnT>) {
                     std::invoke(taskFunctor);
@@ -127,7 +191,148 @@ public:
         m_isWaitingForAllTasksDone = false;
     }
 
+    Metrics metrics() const
+    {
+        Metrics m;
+        m.tasksExecuted = m_tasksExecuted.load(std::memory_order_relaxed);
+        m.queueWaitTime = std::chrono::microseconds(m_queueWaitTimeUs.load(std::memory_order_relaxed));
+        m.runTime = std::chrono::microseconds(m_runTimeUs.load(std::memory_order_relaxed));
+        return m;
+    }
+
+    void resetMetrics()
+    {
+        m_tasksExecuted = 0;
+        m_queueWaitTimeUs = 0;
+        m_runTimeUs = 0;
+    }
+
 private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Task {
+        std::function<void()> func;
+        Clock::time_point enqueueTime;
+    };
+
+    //! NOTE The job of the parallelFor running on the calling thread without the task queue.
+    //! All the atomics are sequentially consistent: a worker registers in activeHelpers before it checks isOpen,
+    //! the calling thread closes isOpen before it checks activeHelpers, so one of them always sees the other
+    struct ForkJoinSlot {
+        void run()
+        {
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                try {
+                    invoke(func, i);
+                } catch (...) {
+                    if (!hasException.exchange(true)) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        void help()
+        {
+            ++activeHelpers;
+            if (isOpen) {
+                run();
+            }
+            --activeHelpers;
+        }
+
+        std::atomic<bool> isBusy = false;
+        std::atomic<bool> isOpen = false;
+        std::atomic<uint64_t> generation = 0;
+        std::atomic<size_t> activeHelpers = 0;
+
+        size_t count = 0;
+        void* func = nullptr;
+        void (* invoke)(void* func, size_t idx) = nullptr;
+        std::atomic<size_t> next = 0;
+
+        std::atomic<bool> hasException = false;
+        std::exception_ptr exception;
+    };
+
+    template<typename FuncT>
+    struct ParallelForJob {
+        ParallelForJob(size_t c, FuncT& f)
+            : count(c), func(f) {}
+
+        void run()
+        {
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                try {
+                    func(i);
+                } catch (...) {
+                    const std::lock_guard lock(mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        void helperRun()
+        {
+            run();
+
+            // the job lives on the stack of the thread that waits for it,
+            // so it must not be touched after the last helper has reported
+            const std::lock_guard lock(mutex);
+            if (--helpersLeft == 0) {
+                helpersDoneCv.notify_one();
+            }
+        }
+
+        void waitForHelpers()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            helpersDoneCv.wait(lock, [this] { return helpersLeft == 0; });
+        }
+
+        const size_t count = 0;
+        FuncT& func;
+        std::atomic<size_t> next = 0;
+
+        std::mutex mutex;
+        std::condition_variable helpersDoneCv;
+        size_t helpersLeft = 0;
+        std::exception_ptr exception;
+    };
+
+    //! NOTE The same as parallelFor, but the helpers get the job through the task queue
+    template<typename FuncT>
+    void parallelForQueued(size_t count, FuncT& func)
+    {
+        ParallelForJob<FuncT> job(count, func);
+
+        const size_t helperCount = std::min(static_cast<size_t>(m_threadPoolSize), count - 1);
+        job.helpersLeft = helperCount;
+
+        {
+            const std::lock_guard lock(m_mutex);
+            for (size_t i = 0; i < helperCount; ++i) {
+                // one pointer fits into the std::function local storage, so no allocation here
+                m_taskQueue.push(Task { [jobPtr = &job]() { jobPtr->helperRun(); }, Clock::now() });
+            }
+        }
+
+        if (helperCount == 1) {
+            m_newTaskAvailableCv.notify_one();
+        } else {
+            m_newTaskAvailableCv.notify_all();
+        }
+
+        job.run();
+        job.waitForHelpers();
+
+        if (job.exception) {
+            std::rethrow_exception(job.exception);
+        }
+    }
+
     void setupThreads()
     {
         m_isActive = true;
@@ -166,20 +371,41 @@ private:
 
     void th_workerLoop()
     {
+        uint64_t helpedGeneration = 0;
+
         while (m_isActive) {
             std::unique_lock<std::mutex> lock(m_mutex);
-            m_newTaskAvailableCv.wait(lock, [this] { return !m_taskQueue.empty() || !m_isActive; });
+            m_newTaskAvailableCv.wait(lock, [this, &helpedGeneration] {
+                return !m_taskQueue.empty() || !m_isActive || m_forkJoin.generation != helpedGeneration;
+            });
 
             if (!m_isActive) {
                 return;
             }
 
-            std::function<void()> task = m_taskQueue.front();
+            //! NOTE The calling thread wakes the workers without the mutex, so a worker that is just going to sleep
+            //! may miss a job. That only means that the calling thread does more of the work itself
+            if (m_forkJoin.generation != helpedGeneration) {
+                lock.unlock();
+                helpedGeneration = m_forkJoin.generation;
+                m_forkJoin.help();
+                continue;
+            }
+
+            Task task = std::move(m_taskQueue.front());
             m_taskQueue.pop();
 
             lock.unlock();
 
-            task();
+            const Clock::time_point startTime = Clock::now();
+            task.func();
+            const Clock::time_point endTime = Clock::now();
+
+            m_tasksExecuted.fetch_add(1, std::memory_order_relaxed);
+            m_queueWaitTimeUs.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(startTime - task.enqueueTime).count(),
+                                        std::memory_order_relaxed);
+            m_runTimeUs.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count(),
+                                  std::memory_order_relaxed);
 
             if (m_isWaitingForAllTasksDone) {
                 m_taskFinishedCv.notify_one();
@@ -193,7 +419,12 @@ private:
     mutable std::mutex m_mutex;
     std::condition_variable m_newTaskAvailableCv;
     std::condition_variable m_taskFinishedCv;
-    std::queue<std::function<void()> > m_taskQueue;
+    std::queue<Task> m_taskQueue;
+    ForkJoinSlot m_forkJoin;
+
+    std::atomic<uint64_t> m_tasksExecuted = 0;
+    std::atomic<int64_t> m_queueWaitTimeUs = 0;
+    std::atomic<int64_t> m_runTimeUs = 0;
 
     thread_pool_size_t m_threadPoolSize = 0;
     std::unique_ptr<std::thread[]> m_threadPool = nullptr;
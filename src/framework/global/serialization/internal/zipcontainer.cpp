@@ -21,11 +21,15 @@
  */
 #include "zipcontainer.h"
 
+#include <algorithm>
 #include <ctime>
 #include <cstring>
+#include <memory>
+#include <unordered_map>
 #include <zlib.h>
 
 #include "global/io/dir.h"
+#include "global/containers.h"
 
 #include "log.h"
 
@@ -110,17 +114,13 @@ static void writeMSDosDate(uint8_t* dest, const std::tm& dt)
     }
 }
 
-static int inflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
 {
     z_stream stream;
     int err;
 
     stream.next_in = const_cast<Bytef*>(source);
     stream.avail_in = (uInt)sourceLen;
-    if ((uLong)stream.avail_in != sourceLen) {
-        return Z_BUF_ERROR;
-    }
-
     stream.next_out = dest;
     stream.avail_out = (uInt) * destLen;
     if ((uLong)stream.avail_out != *destLen) {
@@ -129,58 +129,108 @@ static int inflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourc
 
     stream.zalloc = (alloc_func)0;
     stream.zfree = (free_func)0;
+    stream.opaque = (voidpf)0;
 
-    err = inflateInit2(&stream, -MAX_WBITS);
+    err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
     if (err != Z_OK) {
         return err;
     }
 
-    err = inflate(&stream, Z_FINISH);
+    err = deflate(&stream, Z_FINISH);
     if (err != Z_STREAM_END) {
-        inflateEnd(&stream);
-        if (err == Z_NEED_DICT || (err == Z_BUF_ERROR && stream.avail_in == 0)) {
-            return Z_DATA_ERROR;
-        }
-        return err;
+        deflateEnd(&stream);
+        return err == Z_OK ? Z_BUF_ERROR : err;
     }
     *destLen = stream.total_out;
 
-    err = inflateEnd(&stream);
+    err = deflateEnd(&stream);
     return err;
 }
 
-static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+//! NOTE Compresses the data as it is written, only the compressed data is kept
+class DeflateDevice : public IODevice
 {
-    z_stream stream;
-    int err;
+public:
+    DeflateDevice()
+    {
+        std::memset(&m_stream, 0, sizeof(z_stream));
+        m_isOk = deflateInit2(&m_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+        m_crc = ::crc32(0, 0, 0);
+    }
 
-    stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    stream.next_out = dest;
-    stream.avail_out = (uInt) * destLen;
-    if ((uLong)stream.avail_out != *destLen) {
-        return Z_BUF_ERROR;
+    ~DeflateDevice() override
+    {
+        deflateEnd(&m_stream);
     }
 
-    stream.zalloc = (alloc_func)0;
-    stream.zfree = (free_func)0;
-    stream.opaque = (voidpf)0;
+    bool finish()
+    {
+        m_isOk = m_isOk && deflateInput(nullptr, 0, Z_FINISH);
+        m_compressed.resize(m_compressedSize);
+        return m_isOk;
+    }
 
-    err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
-    if (err != Z_OK) {
-        return err;
+    const ByteArray& compressedData() const { return m_compressed; }
+    uint crc() const { return m_crc; }
+    size_t uncompressedSize() const { return m_uncompressedSize; }
+
+protected:
+    bool doOpen(OpenMode m) override { return m == OpenMode::WriteOnly; }
+    size_t dataSize() const override { return m_uncompressedSize; }
+    const uint8_t* rawData() const override { return nullptr; }
+    bool resizeData(size_t) override { return true; }
+
+    size_t writeData(const uint8_t* data, size_t len) override
+    {
+        m_isOk = m_isOk && deflateInput(data, len, Z_NO_FLUSH);
+        if (!m_isOk) {
+            return 0;
+        }
+
+        m_crc = ::crc32(m_crc, data, (uint)len);
+        m_uncompressedSize += len;
+        return len;
     }
 
-    err = deflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
-        deflateEnd(&stream);
-        return err == Z_OK ? Z_BUF_ERROR : err;
+private:
+    bool deflateInput(const uint8_t* data, size_t len, int flush)
+    {
+        static constexpr size_t MIN_OUTPUT_SPACE = 16 * 1024;
+
+        m_stream.next_in = const_cast<Bytef*>(data);
+        m_stream.avail_in = (uInt)len;
+
+        while (true) {
+            if (m_compressed.size() - m_compressedSize < MIN_OUTPUT_SPACE) {
+                m_compressed.resize(std::max(m_compressed.size() * 2, m_compressedSize + 4 * MIN_OUTPUT_SPACE));
+            }
+
+            m_stream.next_out = m_compressed.data() + m_compressedSize;
+            m_stream.avail_out = (uInt)(m_compressed.size() - m_compressedSize);
+
+            const int res = ::deflate(&m_stream, flush);
+            m_compressedSize = m_compressed.size() - m_stream.avail_out;
+
+            if (res == Z_STREAM_END) {
+                return true;
+            }
+            if (res != Z_OK && res != Z_BUF_ERROR) {
+                LOGE() << "Zip: failed to compress, error: " << res;
+                return false;
+            }
+            if (flush != Z_FINISH && m_stream.avail_in == 0 && m_stream.avail_out > 0) {
+                return true;
+            }
+        }
     }
-    *destLen = stream.total_out;
 
-    err = deflateEnd(&stream);
-    return err;
-}
+    z_stream m_stream;
+    bool m_isOk = false;
+    ByteArray m_compressed;
+    size_t m_compressedSize = 0;
+    uint m_crc = 0;
+    size_t m_uncompressedSize = 0;
+};
 
 namespace WindowsFileAttributes {
 enum {
@@ -374,17 +424,23 @@ struct ZipContainer::Impl {
 
     bool dirtyFileTree = true;
     std::vector<FileHeader> fileHeaders;
+    std::unordered_map<std::string, size_t> fileIndex; // fixed file path -> index in fileHeaders
     ByteArray comment;
     uint start_of_directory = 0;
     ZipContainer::Status status = ZipContainer::NoError;
 
     ZipContainer::CompressionPolicy compressionPolicy = ZipContainer::AlwaysCompress;
 
+    std::unique_ptr<DeflateDevice> pendingFile;
+    std::string pendingFileName;
+
     enum EntryType {
         Directory, File, Symlink
     };
 
     void addEntry(EntryType type, const std::string& fileName, const ByteArray& contents);
+    void writeEntry(EntryType type, const std::string& fileName, const ByteArray& data, ushort compressionMethod, uint crc_32,
+                    size_t uncompressedSize);
     bool writeToDevice(const uint8_t* data, size_t len);
     bool writeToDevice(const ByteArray& data);
 
@@ -392,7 +448,10 @@ struct ZipContainer::Impl {
         : device(d) {}
 
     void scanFiles();
+    void addToIndex(const FileHeader& header);
+    size_t indexOf(const std::string& fileName) const;
     ZipContainer::FileInfo fillFileInfo(size_t index) const;
+    ByteArray inflateFromDevice(size_t compressedSize, size_t uncompressedSize) const;
 
     std::string fixFilePath(const ByteArray& path) const;
 };
@@ -484,10 +543,89 @@ void ZipContainer::Impl::scanFiles()
         }
 
         ZDEBUG("found file '%s'", header.file_name.data());
+        addToIndex(header);
         fileHeaders.push_back(header);
     }
 }
 
+void ZipContainer::Impl::addToIndex(const FileHeader& header)
+{
+    // keep the first entry if a name occurs twice, like a linear search would
+    fileIndex.emplace(fixFilePath(header.file_name.constChar()), fileHeaders.size());
+}
+
+size_t ZipContainer::Impl::indexOf(const std::string& fileName) const
+{
+    auto it = fileIndex.find(fileName);
+    return it != fileIndex.end() ? it->second : muse::nidx;
+}
+
+//! NOTE Inflates directly from the device in fixed-size chunks into a buffer
+//! of the declared uncompressed size, so the compressed data is never held in memory
+//! as a whole. The device must be positioned at the start of the entry data.
+ByteArray ZipContainer::Impl::inflateFromDevice(size_t compressedSize, size_t uncompressedSize) const
+{
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        LOGW("Zip: failed to initialize inflate");
+        return ByteArray();
+    }
+
+    ByteArray result(std::max(uncompressedSize, size_t(1)));
+    std::vector<uint8_t> chunk(std::min(std::max(compressedSize, size_t(1)), CHUNK_SIZE));
+    size_t remaining = compressedSize;
+
+    stream.next_out = result.data();
+    stream.avail_out = (uInt)result.size();
+
+    int res = Z_OK;
+    while (res != Z_STREAM_END) {
+        if (stream.avail_in == 0 && remaining > 0) {
+            const size_t toRead = std::min(remaining, chunk.size());
+            const size_t read = device->read(chunk.data(), toRead);
+            if (read == 0) {
+                LOGW("Zip: unexpected end of data");
+                break;
+            }
+            remaining -= read;
+            stream.next_in = chunk.data();
+            stream.avail_in = (uInt)read;
+        }
+
+        if (stream.avail_out == 0) {
+            // the declared uncompressed size was wrong, grow the buffer
+            const size_t produced = stream.total_out;
+            result.resize(produced * 2);
+            stream.next_out = result.data() + produced;
+            stream.avail_out = (uInt)(result.size() - produced);
+        }
+
+        res = inflate(&stream, Z_NO_FLUSH);
+        if (res == Z_BUF_ERROR && stream.avail_in == 0 && remaining == 0) {
+            LOGW("Zip: Z_DATA_ERROR: Input data is truncated");
+            break;
+        }
+
+        if (res == Z_MEM_ERROR) {
+            LOGW("Zip: Z_MEM_ERROR: Not enough memory");
+            break;
+        }
+
+        if (res == Z_DATA_ERROR || res == Z_NEED_DICT || res == Z_STREAM_ERROR) {
+            LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
+            break;
+        }
+    }
+
+    result.resize(stream.total_out);
+    inflateEnd(&stream);
+
+    return result;
+}
+
 ZipContainer::FileInfo ZipContainer::Impl::fillFileInfo(size_t index) const
 {
     ZipContainer::FileInfo fileInfo;
@@ -543,12 +681,6 @@ ZipContainer::FileInfo ZipContainer::Impl::fillFileInfo(size_t index) const
 
 void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, const ByteArray& contents)
 {
-    if (!(device->isOpen() || device->open(IODevice::WriteOnly))) {
-        status = ZipContainer::FileOpenError;
-        return;
-    }
-    device->seek(start_of_directory);
-
     // don't compress small files
     ZipContainer::CompressionPolicy compression = compressionPolicy;
     if (compressionPolicy == ZipContainer::AutoCompress) {
@@ -559,24 +691,10 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
         }
     }
 
-    FileHeader header;
-    std::memset(&header.h, 0, sizeof(CentralFileHeader));
-    writeUInt(header.h.signature, 0x02014b50);
-
-    writeUShort(header.h.version_needed, ZIP_VERSION);
-    writeUInt(header.h.uncompressed_size, (uint)contents.size());
-
-    std::time_t t = std::time(0);   // get time now
-    std::tm now;
-#ifdef WIN32
-    localtime_s(&now, &t);
-#else
-    localtime_r(&t, &now);
-#endif
-    writeMSDosDate(header.h.last_mod_file, now);
     ByteArray data = contents;
+    ushort compressionMethod = CompressionMethodStored;
     if (compression == ZipContainer::AlwaysCompress) {
-        writeUShort(header.h.compression_method, CompressionMethodDeflated);
+        compressionMethod = CompressionMethodDeflated;
 
         ulong len = (ulong)contents.size();
         // shamelessly copied form zlib
@@ -601,9 +719,38 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
         } while (res == Z_BUF_ERROR);
     }
 // TODO add a check if data.size() > contents.size().  Then try to store the original and revert the compression method to be uncompressed
-    writeUInt(header.h.compressed_size, (uint)data.size());
     uint crc_32 = ::crc32(0, 0, 0);
     crc_32 = ::crc32(crc_32, (const uint8_t*)contents.constData(), (uint)contents.size());
+
+    writeEntry(type, fileName, data, compressionMethod, crc_32, contents.size());
+}
+
+void ZipContainer::Impl::writeEntry(EntryType type, const std::string& fileName, const ByteArray& data, ushort compressionMethod,
+                                    uint crc_32, size_t uncompressedSize)
+{
+    if (!(device->isOpen() || device->open(IODevice::WriteOnly))) {
+        status = ZipContainer::FileOpenError;
+        return;
+    }
+    device->seek(start_of_directory);
+
+    FileHeader header;
+    std::memset(&header.h, 0, sizeof(CentralFileHeader));
+    writeUInt(header.h.signature, 0x02014b50);
+
+    writeUShort(header.h.version_needed, ZIP_VERSION);
+    writeUInt(header.h.uncompressed_size, (uint)uncompressedSize);
+
+    std::time_t t = std::time(0);   // get time now
+    std::tm now;
+#ifdef WIN32
+    localtime_s(&now, &t);
+#else
+    localtime_r(&t, &now);
+#endif
+    writeMSDosDate(header.h.last_mod_file, now);
+    writeUShort(header.h.compression_method, compressionMethod);
+    writeUInt(header.h.compressed_size, (uint)data.size());
     writeUInt(header.h.crc_32, crc_32);
 
     // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
@@ -648,6 +795,7 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     writeUInt(header.h.external_file_attributes, mode << 16);
     writeUInt(header.h.offset_local_header, start_of_directory);
 
+    addToIndex(header);
     fileHeaders.push_back(header);
 
     bool ok = true;
@@ -735,33 +883,19 @@ bool ZipContainer::fileExists(const std::string& fileName) const
 {
     p->scanFiles();
 
-    for (size_t i = 0; i < p->fileHeaders.size(); ++i) {
-        std::string currentFileName = p->fixFilePath(p->fileHeaders.at(i).file_name.constChar());
-        if (currentFileName == fileName) {
-            return true;
-        }
-    }
-
-    return false;
+    return p->indexOf(fileName) != muse::nidx;
 }
 
 ByteArray ZipContainer::fileData(const std::string& fileName) const
 {
     p->scanFiles();
 
-    size_t i = 0;
-    for (i = 0; i < p->fileHeaders.size(); ++i) {
-        std::string currentFileName = p->fixFilePath(p->fileHeaders.at(i).file_name.constChar());
-        if (currentFileName == fileName) {
-            break;
-        }
-    }
-
-    if (i == p->fileHeaders.size()) {
+    const size_t i = p->indexOf(fileName);
+    if (i == muse::nidx) {
         return ByteArray();
     }
 
-    FileHeader header = p->fileHeaders.at(i);
+    const FileHeader& header = p->fileHeaders.at(i);
 
     ushort version_needed = readUShort(header.h.version_needed);
     if (version_needed > ZIP_VERSION) {
@@ -787,41 +921,13 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
         return ByteArray();
     }
 
-    ByteArray compressed = p->device->read(compressed_size);
     if (compression_method == CompressionMethodStored) {
         // no compression
-        compressed.truncate(uncompressed_size);
-        return compressed;
+        ByteArray data = p->device->read(compressed_size);
+        data.truncate(uncompressed_size);
+        return data;
     } else if (compression_method == CompressionMethodDeflated) {
-        // Deflate
-        //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
-        ByteArray baunzip;
-        ulong len = std::max(uncompressed_size,  1);
-        int res;
-        do {
-            baunzip.resize(len);
-            res = inflate((uint8_t*)baunzip.data(), &len,
-                          (const uint8_t*)compressed.constData(), compressed_size);
-
-            switch (res) {
-            case Z_OK:
-                if ((size_t)len != baunzip.size()) {
-                    baunzip.resize(len);
-                }
-                break;
-            case Z_MEM_ERROR:
-                LOGW("Zip: Z_MEM_ERROR: Not enough memory");
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            case Z_DATA_ERROR:
-                LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
-        return baunzip;
+        return p->inflateFromDevice(compressed_size, uncompressed_size);
     }
 
     LOGW("Zip: Unsupported compression method %d is needed to extract the data.", compression_method);
@@ -845,9 +951,42 @@ ZipContainer::CompressionPolicy ZipContainer::compressionPolicy() const
 
 void ZipContainer::addFile(const std::string& fileName, const ByteArray& data)
 {
+    IF_ASSERT_FAILED(!p->pendingFile) {
+        return;
+    }
+
     p->addEntry(Impl::File, Dir::fromNativeSeparators(fileName).toStdString(), data);
 }
 
+IODevice* ZipContainer::beginFile(const std::string& fileName)
+{
+    IF_ASSERT_FAILED(!p->pendingFile) {
+        return nullptr;
+    }
+
+    p->pendingFile = std::make_unique<DeflateDevice>();
+    p->pendingFile->open(IODevice::WriteOnly);
+    p->pendingFileName = Dir::fromNativeSeparators(fileName).toStdString();
+
+    return p->pendingFile.get();
+}
+
+void ZipContainer::endFile()
+{
+    IF_ASSERT_FAILED(p->pendingFile) {
+        return;
+    }
+
+    std::unique_ptr<DeflateDevice> file = std::move(p->pendingFile);
+    if (!file->finish()) {
+        p->status = ZipContainer::FileWriteError;
+        return;
+    }
+
+    p->writeEntry(Impl::File, p->pendingFileName, file->compressedData(), CompressionMethodDeflated, file->crc(),
+                  file->uncompressedSize());
+}
+
 void ZipContainer::addDirectory(const std::string& dirName)
 {
     std::string name(Dir::fromNativeSeparators(dirName).toStdString());
@@ -860,6 +999,10 @@ void ZipContainer::addDirectory(const std::string& dirName)
 
 void ZipContainer::close()
 {
+    if (p->pendingFile) {
+        endFile();
+    }
+
     if (!(p->device->openMode() & IODevice::WriteOnly)) {
         p->device->close();
         return;
@@ -79,6 +79,12 @@ public:
     void addFile(const std::string& fileName, const ByteArray& data);
     void addDirectory(const std::string& dirName);
 
+    //! NOTE For large data that is produced gradually: the returned device compresses the data
+    //! as it is written, so only the compressed data is kept, and endFile adds it to the archive.
+    //! No other file may be added in between
+    io::IODevice* beginFile(const std::string& fileName);
+    void endFile();
+
 private:
 
     struct Impl;
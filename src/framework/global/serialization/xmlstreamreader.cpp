@@ -22,6 +22,7 @@
 #include "xmlstreamreader.h"
 
 #include <cstring>
+#include <utility>
 
 #include "global/types/string.h"
 #ifdef SYSTEM_TINYXML
@@ -75,6 +76,21 @@ XmlStreamReader::~XmlStreamReader()
     delete m_xml;
 }
 
+XmlStreamReader::XmlStreamReader(XmlStreamReader&& other)
+{
+    m_xml = new Xml();
+    *this = std::move(other);
+}
+
+XmlStreamReader& XmlStreamReader::operator=(XmlStreamReader&& other)
+{
+    //! NOTE The parsed documents are swapped, the other one is released with the other reader
+    std::swap(m_xml, other.m_xml);
+    std::swap(m_token, other.m_token);
+    std::swap(m_entities, other.m_entities);
+    return *this;
+}
+
 void XmlStreamReader::setData(const ByteArray& data_)
 {
     m_xml->doc.Clear();
@@ -112,6 +128,19 @@ void XmlStreamReader::setData(const ByteArray& data_)
     }
 }
 
+bool XmlStreamReader::rewind()
+{
+    if (m_xml->err != tinyxml2::XML_SUCCESS || !m_xml->doc.FirstChild()) {
+        return false;
+    }
+
+    m_xml->node = nullptr;
+    m_xml->customErr.clear();
+    m_token = TokenType::NoToken;
+
+    return true;
+}
+
 bool XmlStreamReader::readNextStartElement()
 {
     while (readNext() != Invalid) {
@@ -75,9 +75,15 @@ public:
 
     XmlStreamReader(const XmlStreamReader&) = delete;
     XmlStreamReader& operator=(const XmlStreamReader&) = delete;
+    XmlStreamReader(XmlStreamReader&& other);
+    XmlStreamReader& operator=(XmlStreamReader&& other);
 
     void setData(const ByteArray& data);
 
+    //! NOTE Read the already parsed document again from the start,
+    //! returns false if there is no successfully parsed document
+    bool rewind();
+
     bool readNextStartElement();
     bool atEnd() const;
     void skipCurrentElement();
@@ -94,3 +94,14 @@ void ZipWriter::addFile(const std::string& fileName, const ByteArray& data)
     m_impl->zip->addFile(fileName, data);
     flush();
 }
+
+io::IODevice* ZipWriter::beginFile(const std::string& fileName)
+{
+    return m_impl->zip->beginFile(fileName);
+}
+
+void ZipWriter::endFile()
+{
+    m_impl->zip->endFile();
+    flush();
+}
@@ -39,6 +39,11 @@ public:
 
     void addFile(const std::string& fileName, const ByteArray& data);
 
+    //! NOTE Adds a file whose data is written gradually to the returned device and compressed on the fly,
+    //! the file is complete after endFile. No other file may be added in between
+    io::IODevice* beginFile(const std::string& fileName);
+    void endFile();
+
 private:
 
     void flush();
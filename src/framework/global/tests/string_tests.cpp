@@ -21,9 +21,11 @@
  */
 #include <gtest/gtest.h>
 
+#include <cstdlib>
 #include <cstring>
 #include <regex>
 #include <string>
+#include <vector>
 
 #include <QString>
 
@@ -849,6 +851,19 @@ TEST_F(Global_Types_StringTests, AsciiString_ToDouble)
         EXPECT_FALSE(ok);
         EXPECT_DOUBLE_EQ(v, 0.0);
     }
+
+    {
+        //! GIVEN Some strings, that are parsed with and without strtod
+        std::vector<const char*> strs = { "-12.375", ".5", "5.", "-0.0001", "0.30000000000000004", "1e3", "123456789.123456789" };
+        for (const char* str : strs) {
+            //! DO
+            bool ok = false;
+            double v = AsciiStringView(str).toDouble(&ok);
+            //! CHECK Same result as strtod
+            EXPECT_TRUE(ok);
+            EXPECT_EQ(v, std::strtod(str, nullptr));
+        }
+    }
 }
 
 TEST_F(Global_Types_StringTests, String_DecodeXmlEntities)
@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "global/concurrency/taskscheduler.h"
+
+using namespace muse;
+
+class Global_Concurrency_TaskSchedulerTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelFor)
+{
+    //! GIVEN scheduler with a few threads
+    TaskScheduler scheduler(4);
+
+    for (size_t count = 0; count < 64; ++count) {
+        //! DO process every index
+        std::vector<int> values(count, 0);
+        scheduler.parallelFor(count, [&values](size_t idx) {
+            values[idx] += static_cast<int>(idx) + 1;
+        });
+
+        //! CHECK every index is processed exactly once
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(values[i], static_cast<int>(i) + 1);
+        }
+    }
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelFor_Exception)
+{
+    //! GIVEN scheduler
+    TaskScheduler scheduler(2);
+
+    //! DO throw from one of the items
+    //! CHECK the exception is rethrown in the calling thread
+    EXPECT_THROW(scheduler.parallelFor(8, [](size_t idx) {
+        if (idx == 5) {
+            throw std::runtime_error("error");
+        }
+    }), std::runtime_error);
+
+    //! CHECK the scheduler is still usable
+    std::future<int> result = scheduler.submit([](int v) { return v * 2; }, 21);
+    EXPECT_EQ(result.get(), 42);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelFor_Repeated)
+{
+    //! GIVEN scheduler, used like by the audio callback
+    TaskScheduler scheduler(3);
+
+    //! DO run many short jobs in a row
+    std::vector<std::atomic<int> > values(8);
+    for (int run = 0; run < 2000; ++run) {
+        scheduler.parallelFor(values.size(), [&values](size_t idx) {
+            ++values[idx];
+        });
+    }
+
+    //! CHECK no index is lost or processed twice
+    for (const std::atomic<int>& value : values) {
+        EXPECT_EQ(value, 2000);
+    }
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelFor_ConcurrentCallers)
+{
+    //! GIVEN scheduler, shared by a few threads
+    TaskScheduler scheduler(4);
+
+    //! DO run jobs from all the threads at once, so that some of them go through the task queue
+    std::atomic<int> total = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&scheduler, &total]() {
+            for (int run = 0; run < 200; ++run) {
+                scheduler.parallelFor(16, [&total](size_t) {
+                    ++total;
+                });
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    //! CHECK every job has processed all its indexes
+    EXPECT_EQ(total, 4 * 200 * 16);
+}
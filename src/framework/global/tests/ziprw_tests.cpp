@@ -55,3 +55,33 @@ TEST_F(Zip_RW_Tests, Write_And_Read)
 
     reader.close();
 }
+
+TEST_F(Zip_RW_Tests, Write_Gradually_And_Read)
+{
+    //! [GIVEN] A zip file
+    io::IODevice* device = new io::File("test_gradually.zip");
+    ZipWriter writer(device);
+
+    //! [WHEN] Writing the data of a file in pieces
+    writer.addFile("file1.txt", "Hello World!");
+
+    ByteArray expected;
+    io::IODevice* file = writer.beginFile("folder/file2.txt");
+    ASSERT_TRUE(file);
+    for (int i = 0; i < 10000; ++i) {
+        const std::string line = "Line " + std::to_string(i) + "\n";
+        file->write(reinterpret_cast<const uint8_t*>(line.c_str()), line.size());
+        expected.push_back(reinterpret_cast<const uint8_t*>(line.c_str()), line.size());
+    }
+    writer.endFile();
+
+    writer.close();
+    EXPECT_FALSE(writer.hasError());
+
+    //! [THEN] The data can be read back
+    ZipReader reader(device);
+    EXPECT_EQ(reader.fileData("file1.txt"), "Hello World!");
+    EXPECT_EQ(reader.fileData("folder/file2.txt"), expected);
+
+    reader.close();
+}
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <cctype>
 #include <clocale>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
@@ -48,17 +49,16 @@ constexpr unsigned char U16BE_BOM[] = { 254, 255 };
 
 static long int toInt_helper(const char* str, bool* ok, int base)
 {
-    if (!str || std::strlen(str) == 0) {
+    if (!str || *str == '\0') {
         if (ok) {
             *ok = false;
         }
         return 0;
     }
-    const char* currentLoc = setlocale(LC_NUMERIC, "C");
+    //! NOTE The numeric locale does not affect parsing of integers, so there is no need to switch it
     char* end = nullptr;
     long int v = static_cast<int>(std::strtol(str, &end, base));
-    setlocale(LC_NUMERIC, currentLoc);
-    bool myOk = std::strlen(end) == 0;
+    bool myOk = *end == '\0';
     if (!myOk) {
         v = 0;
     }
@@ -69,18 +69,81 @@ static long int toInt_helper(const char* str, bool* ok, int base)
     return v;
 }
 
+//! NOTE Fast path for plain decimals like "-12.375", which is how numbers are written to files.
+//! If the digits fit into the mantissa and there are not too many fractional digits,
+//! the division of two exactly representable values gives the same correctly rounded
+//! result as strtod, without switching the locale
+static bool toDouble_fastPath(const char* str, double* result)
+{
+    static constexpr double POW10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    static constexpr int MAX_DIGITS = 15;
+    static constexpr int MAX_FRACTION_DIGITS = 22;
+
+    const char* p = str;
+    bool negative = false;
+    if (*p == '-' || *p == '+') {
+        negative = *p == '-';
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int fractionDigits = 0;
+
+    for (; *p >= '0' && *p <= '9'; ++p) {
+        if (mantissa == 0 && *p == '0') {
+            continue; // leading zeros are not significant
+        }
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+        ++digits;
+    }
+    bool hasDigits = p != str && (p[-1] >= '0' && p[-1] <= '9');
+
+    if (*p == '.') {
+        ++p;
+        for (; *p >= '0' && *p <= '9'; ++p) {
+            hasDigits = true;
+            ++fractionDigits;
+            if (mantissa == 0 && *p == '0') {
+                continue;
+            }
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            ++digits;
+        }
+    }
+
+    if (*p != '\0' || !hasDigits || digits > MAX_DIGITS || fractionDigits > MAX_FRACTION_DIGITS) {
+        return false;
+    }
+
+    double v = static_cast<double>(mantissa) / POW10[fractionDigits];
+    *result = negative ? -v : v;
+    return true;
+}
+
 static double toDouble_helper(const char* str, bool* ok)
 {
     if (!str) {
         return 0.0;
     }
+
+    double v = 0.0;
+    if (toDouble_fastPath(str, &v)) {
+        if (ok) {
+            *ok = true;
+        }
+        return v;
+    }
+
     const char* currentLoc = setlocale(LC_NUMERIC, "C");
     char* end = nullptr;
-    double v = std::strtod(str, &end);
+    v = std::strtod(str, &end);
     setlocale(LC_NUMERIC, currentLoc);
     if (ok) {
-        size_t sz = std::strlen(end);
-        *ok = sz != std::strlen(str);
+        *ok = end != str;
     }
     return v;
 }
@@ -97,7 +97,7 @@ muse::audio::gain_t VstSequencer::currentGain() const
     return 0.5f;
 }
 
-void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& events)
+void VstSequencer::updatePlaybackEvents(EventList& destination, const mpe::PlaybackEventsMap& events)
 {
     SostenutoTimeAndDurations sostenutoTimeAndDurations;
 
@@ -116,8 +116,8 @@ void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe
             float velocityFraction = noteVelocityFraction(noteEvent);
             float tuning = noteTuning(noteEvent, noteId);
 
-            destination[timestampFrom].emplace(buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
-            destination[timestampTo].emplace(buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
+            destination.add(timestampFrom, buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
+            destination.add(timestampTo, buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
 
             for (const auto& articPair : noteEvent.expressionCtx().articulations) {
                 const mpe::ArticulationMeta& meta = articPair.second.meta;
@@ -145,16 +145,16 @@ void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe
     appendSostenutoEvents(destination, sostenutoTimeAndDurations);
 }
 
-void VstSequencer::updateDynamicEvents(EventSequenceMap& destination, const mpe::DynamicLevelLayers& layers)
+void VstSequencer::updateDynamicEvents(EventList& destination, const mpe::DynamicLevelLayers& layers)
 {
     for (const auto& layer : layers) {
         for (const auto& dynamic : layer.second) {
-            destination[dynamic.first].emplace(expressionLevel(dynamic.second));
+            destination.add(dynamic.first, expressionLevel(dynamic.second));
         }
     }
 }
 
-void VstSequencer::appendParamChange(EventSequenceMap& destination, const mpe::timestamp_t timestamp,
+void VstSequencer::appendParamChange(EventList& destination, const mpe::timestamp_t timestamp,
                                      const ControlIdx controlIdx, const PluginParamValue value)
 {
     auto controlIt = m_mapping.find(controlIdx);
@@ -162,10 +162,10 @@ void VstSequencer::appendParamChange(EventSequenceMap& destination, const mpe::t
         return;
     }
 
-    destination[timestamp].emplace(ParamChangeEvent { controlIt->second, value });
+    destination.add(timestamp, ParamChangeEvent { controlIt->second, value });
 }
 
-void VstSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void VstSequencer::appendPitchBend(EventList& destination, const mpe::NoteEvent& noteEvent,
                                    const mpe::ArticulationMeta& artMeta)
 {
     auto pitchBendIt = m_mapping.find(PITCH_BEND_IDX);
@@ -179,7 +179,7 @@ void VstSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::Not
     ParamChangeEvent event;
     event.paramId = pitchBendIt->second;
     event.value = 0.5f;
-    destination[pitchBendTimestampTo].insert(event);
+    destination.add(pitchBendTimestampTo, event);
 
     auto currIt = noteEvent.pitchCtx().pitchCurve.cbegin();
     auto nextIt = std::next(currIt);
@@ -212,13 +212,13 @@ void VstSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::Not
             if (time < pitchBendTimestampTo) {
                 float bendValue = static_cast<float>(point.y);
                 event.value = bendValue;
-                destination[time].insert(event);
+                destination.add(time, event);
             }
         }
     }
 }
 
-void VstSequencer::appendSostenutoEvents(EventSequenceMap& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations)
+void VstSequencer::appendSostenutoEvents(EventList& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations)
 {
     for (size_t i = 0; i < sostenutoTimeAndDurations.size(); ++i) {
         const mpe::TimestampAndDuration& currentTnD = sostenutoTimeAndDurations.at(i);
@@ -66,15 +66,15 @@ private:
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics,
                                 const mpe::PlaybackParamLayers& params) override;
 
-    void updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& events);
-    void updateDynamicEvents(EventSequenceMap& destination, const mpe::DynamicLevelLayers& layers);
+    void updatePlaybackEvents(EventList& destination, const mpe::PlaybackEventsMap& events);
+    void updateDynamicEvents(EventList& destination, const mpe::DynamicLevelLayers& layers);
 
-    void appendParamChange(EventSequenceMap& destination, const mpe::timestamp_t timestamp, const ControlIdx controlIdx,
+    void appendParamChange(EventList& destination, const mpe::timestamp_t timestamp, const ControlIdx controlIdx,
                            const PluginParamValue value);
-    void appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationMeta& artMeta);
+    void appendPitchBend(EventList& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationMeta& artMeta);
 
     using SostenutoTimeAndDurations = std::vector<mpe::TimestampAndDuration>;
-    void appendSostenutoEvents(EventSequenceMap& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations);
+    void appendSostenutoEvents(EventList& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations);
 
     VstEvent buildEvent(const Steinberg::Vst::Event::EventTypes type, const int32_t noteIdx, const float velocityFraction,
                         const float tuning) const;
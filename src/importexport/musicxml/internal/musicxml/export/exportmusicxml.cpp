@@ -8698,12 +8698,16 @@ static void writeMxlArchive(Score* score, muse::ZipWriter& zip, const String& fi
 
     zip.addFile("META-INF/container.xml", cbuf.data());
 
-    muse::io::Buffer dbuf;
-    dbuf.open(muse::io::IODevice::ReadWrite);
-    ExportMusicXml em(score);
-    em.write(&dbuf);
-    dbuf.seek(0);
-    zip.addFile(filename.toStdString(), dbuf.data());
+    // the score is compressed while it is being written, so it is never kept uncompressed in memory
+    muse::io::IODevice* scoreDevice = zip.beginFile(filename.toStdString());
+    if (!scoreDevice) {
+        return;
+    }
+    {
+        ExportMusicXml em(score);
+        em.write(scoreDevice);
+    }
+    zip.endFile();
 }
 
 bool saveMxl(Score* score, IODevice* device)
@@ -8715,7 +8719,7 @@ bool saveMxl(Score* score, IODevice* device)
     writeMxlArchive(score, zip, fn);
     zip.close();
 
-    return true;
+    return !zip.hasError();
 }
 
 bool saveMxl(Score* score, const String& name)
@@ -8727,7 +8731,7 @@ bool saveMxl(Score* score, const String& name)
     writeMxlArchive(score, zip, fn);
     zip.close();
 
-    return true;
+    return !zip.hasError();
 }
 
 double ExportMusicXml::getTenthsFromInches(double inches) const
@@ -195,6 +195,7 @@ public:
     MusicXmlInstrList getInstrList(const muse::String& id) const;
     MusicXmlIntervalList getIntervals(const muse::String& id) const;
     engraving::Fraction getMeasureStart(const size_t i) const;
+    muse::XmlStreamReader takeReader() { return std::move(m_e); }
     int octaveShift(const muse::String& id, const engraving::staff_idx_t staff, const engraving::Fraction& f) const;
     const CreditWordsList& credits() const { return m_credits; }
     bool hasBeamingInfo() const { return m_hasBeamingInfo; }
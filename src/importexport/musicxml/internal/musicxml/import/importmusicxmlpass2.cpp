@@ -1942,7 +1942,11 @@ void MusicXmlParserPass2::skipLogCurrElem()
 Err MusicXmlParserPass2::parse(const ByteArray& data)
 {
     //LOGD("MusicXmlParserPass2::parse()");
-    m_e.setData(data);
+    //! NOTE Pass 1 has already parsed the document, read it again instead of parsing it twice
+    m_e = m_pass1.takeReader();
+    if (!m_e.rewind()) {
+        m_e.setData(data);
+    }
     Err res = parse();
     //LOGD("MusicXmlParserPass2::parse() res %d", int(res));
     return res;
@@ -236,6 +236,7 @@ muse::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, c
         opt.fromPage = page->no();
         opt.toPage = opt.fromPage;
         opt.deviceDpi = CANVAS_DPI;
+        opt.isRecordPages = true;
 
         painter.fillRect(frameRect, Color::WHITE);
 
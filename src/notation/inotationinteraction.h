@@ -49,6 +49,11 @@ public:
     virtual muse::RectF shadowNoteRect() const = 0;
     virtual muse::async::Notification shadowNoteChanged() const = 0;
 
+    // Refresh
+    //! NOTE Sent after the score has been updated, with the changed area in logical coordinates.
+    //! An invalid rect means that the whole score has changed
+    virtual muse::async::Channel<muse::RectF> scoreRefreshRequested() const = 0;
+
     // Visibility
     virtual void toggleVisible() = 0;
 
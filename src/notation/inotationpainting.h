@@ -46,6 +46,8 @@ public:
     virtual muse::SizeF pageSizeInch(const Options& opt) const = 0;
 
     virtual void paintView(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewScore(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewInteraction(muse::draw::Painter* painter) = 0;
     virtual void paintPdf(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(muse::draw::Painter* painter, const Options& opt) = 0;
@@ -554,6 +554,11 @@ muse::async::Notification NotationInteraction::shadowNoteChanged() const
     return m_shadowNoteChanged;
 }
 
+muse::async::Channel<muse::RectF> NotationInteraction::scoreRefreshRequested() const
+{
+    return m_scoreCallbacks.refreshRequested();
+}
+
 void NotationInteraction::toggleVisible()
 {
     startEdit(TranslatableString("undoableAction", "Toggle visible"));
@@ -641,7 +646,8 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
 
     RectF hitRect(posOnPage.x() - width, posOnPage.y() - width, 3.0 * width, 3.0 * width);
 
-    std::vector<EngravingItem*> potentiallyHitElements = page->items(hitRect);
+    std::vector<EngravingItem*>& potentiallyHitElements = m_potentiallyHitElements;
+    page->items(hitRect, potentiallyHitElements);
 
     for (int i = 0; i < engraving::MAX_HEADERS; ++i) {
         if (score()->headerText(i) != nullptr) { // gives the ability to select the header
@@ -73,6 +73,9 @@ public:
     muse::RectF shadowNoteRect() const override;
     muse::async::Notification shadowNoteChanged() const override;
 
+    // Refresh
+    muse::async::Channel<muse::RectF> scoreRefreshRequested() const override;
+
     // Visibility
     void toggleVisible() override;
 
@@ -537,6 +540,7 @@ private:
 
     bool m_notifyAboutDropChanged = false;
     HitElementContext m_hitElementContext;
+    mutable std::vector<EngravingItem*> m_potentiallyHitElements; // reused by hitElements() on every mouse move
 
     muse::async::Channel<ShowItemRequest> m_showItemRequested;
 };
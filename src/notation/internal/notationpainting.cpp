@@ -117,6 +117,20 @@ void NotationPainting::doPaint(Painter* painter, const Options& opt)
         return;
     }
 
+    doPaintScore(painter, opt);
+
+    if (!opt.isPrinting) {
+        paintViewInteraction(painter);
+    }
+}
+
+void NotationPainting::doPaintScore(Painter* painter, const Options& opt)
+{
+    TRACEFUNC;
+    if (!score()) {
+        return;
+    }
+
     Options myopt = opt;
     bool printPageBackground = myopt.printPageBackground;
     myopt.onPaintPageSheet = [this, printPageBackground](Painter* painter, const Page* page, const RectF& pageRect) {
@@ -124,10 +138,6 @@ void NotationPainting::doPaint(Painter* painter, const Options& opt)
     };
 
     scoreRenderer()->paintScore(painter, score(), myopt);
-
-    if (!myopt.isPrinting) {
-        static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
-    }
 }
 
 void NotationPainting::paintPageSheet(Painter* painter, const Page* page, const RectF& pageRect, bool printPageBackground) const
@@ -178,7 +188,7 @@ void NotationPainting::paintPageSheet(Painter* painter, const Page* page, const
     }
 }
 
-void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
+NotationPainting::Options NotationPainting::viewOptions(const RectF& frameRect, bool isPrinting) const
 {
     Options opt;
     opt.isSetViewport = false;
@@ -186,7 +196,28 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->logicalDpi();
     opt.isPrinting = isPrinting;
-    doPaint(painter, opt);
+    return opt;
+}
+
+void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    doPaint(painter, viewOptions(frameRect, isPrinting));
+}
+
+//! NOTE Paints only the pages and the score on them, without the interaction state (selection range, grips, drop targets, etc.),
+//! so that the result can be cached by the view and the interaction painted over it
+void NotationPainting::paintViewScore(Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    doPaintScore(painter, viewOptions(frameRect, isPrinting));
+}
+
+void NotationPainting::paintViewInteraction(Painter* painter)
+{
+    if (!score()) {
+        return;
+    }
+
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
 }
 
 void NotationPainting::paintPdf(Painter* painter, const Options& opt)
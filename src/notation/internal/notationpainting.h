@@ -56,6 +56,8 @@ public:
     muse::SizeF pageSizeInch(const Options& opt) const override;
 
     void paintView(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) override;
+    void paintViewScore(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) override;
+    void paintViewInteraction(muse::draw::Painter* painter) override;
     void paintPdf(muse::draw::Painter* painter, const Options& opt) override;
     void paintPrint(muse::draw::Painter* painter, const Options& opt) override;
     void paintPng(muse::draw::Painter* painter, const Options& opt) override;
@@ -64,7 +66,9 @@ private:
     mu::engraving::Score* score() const;
 
     bool isPaintPageBorder() const;
+    Options viewOptions(const muse::RectF& frameRect, bool isPrinting) const;
     void doPaint(muse::draw::Painter* painter, const Options& opt);
+    void doPaintScore(muse::draw::Painter* painter, const Options& opt);
     void paintPageBorder(muse::draw::Painter* painter, const mu::engraving::Page* page) const;
     void paintPageSheet(muse::draw::Painter* painter, const engraving::Page* page, const muse::RectF& pageRect,
                         bool printPageBackground) const;
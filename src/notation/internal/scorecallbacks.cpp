@@ -22,20 +22,51 @@
 #include "scorecallbacks.h"
 
 #include "engraving/dom/engravingitem.h"
+#include "engraving/dom/score.h"
 #include "inotationinteraction.h"
 
 #include "log.h"
 
 using namespace mu::notation;
 
-void ScoreCallbacks::dataChanged(const muse::RectF&)
+ScoreCallbacks::~ScoreCallbacks()
 {
-    NOT_IMPLEMENTED;
+    if (m_score) {
+        m_score->removeViewer(this);
+    }
+}
+
+//! NOTE Registered as a viewer, so that Score::update() reports the refreshed area
+void ScoreCallbacks::setScore(mu::engraving::Score* score)
+{
+    if (m_score == score) {
+        return;
+    }
+
+    if (m_score) {
+        m_score->removeViewer(this);
+    }
+
+    mu::engraving::MuseScoreView::setScore(score);
+
+    if (m_score) {
+        m_score->addViewer(this);
+    }
+}
+
+void ScoreCallbacks::removeScore()
+{
+    m_score = nullptr;
+}
+
+void ScoreCallbacks::dataChanged(const muse::RectF& rect)
+{
+    m_refreshRequested.send(rect);
 }
 
 void ScoreCallbacks::updateAll()
 {
-    NOT_IMPLEMENTED;
+    m_refreshRequested.send(muse::RectF());
 }
 
 void ScoreCallbacks::drawBackground(muse::draw::Painter*, const muse::RectF&) const
@@ -93,3 +124,8 @@ void ScoreCallbacks::setNotationInteraction(INotationInteraction* interaction)
 {
     m_interaction = interaction;
 }
+
+muse::async::Channel<muse::RectF> ScoreCallbacks::refreshRequested() const
+{
+    return m_refreshRequested;
+}
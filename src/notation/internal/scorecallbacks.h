@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_SCORECALLBACKS_H
 #define MU_NOTATION_SCORECALLBACKS_H
 
+#include "async/channel.h"
+
 #include "engraving/dom/mscoreview.h"
 
 namespace mu::notation {
@@ -30,6 +32,10 @@ class ScoreCallbacks : public mu::engraving::MuseScoreView
 {
 public:
     ScoreCallbacks() = default;
+    ~ScoreCallbacks() override;
+
+    void setScore(mu::engraving::Score* score) override;
+    void removeScore() override;
 
     void dataChanged(const muse::RectF&) override;
     void updateAll() override;
@@ -43,8 +49,11 @@ public:
     void setSelectionProximity(qreal proximity);
     void setNotationInteraction(INotationInteraction* interaction);
 
+    muse::async::Channel<muse::RectF> refreshRequested() const;
+
 private:
     qreal m_selectionProximity = 0.0f;
+    muse::async::Channel<muse::RectF> m_refreshRequested;
 
     INotationInteraction* m_interaction = nullptr;
 };
@@ -37,6 +37,8 @@ public:
     MOCK_METHOD(muse::RectF, shadowNoteRect, (), (const, override));
     MOCK_METHOD(muse::async::Notification, shadowNoteChanged, (), (const, override));
 
+    MOCK_METHOD(muse::async::Channel<muse::RectF>, scoreRefreshRequested, (), (const, override));
+
     MOCK_METHOD(void, toggleVisible, (), (override));
 
     MOCK_METHOD(EngravingItem*, hitElement, (const muse::PointF&, float), (const, override));
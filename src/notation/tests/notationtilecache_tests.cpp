@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QImage>
+#include <QPainter>
+
+#include "notation/view/notationtilecache.h"
+
+using namespace mu::notation;
+using namespace muse;
+using namespace muse::draw;
+
+//! NOTE The view is covered by 2x2 tiles of 512 pixels at scale 1
+static constexpr int VIEW_SIZE = 1024;
+
+class NotationTileCacheTests : public ::testing::Test
+{
+public:
+    //! NOTE Paints the whole view and returns the logical rects of the tiles that had to be rendered
+    std::vector<RectF> paint(NotationTileCache& cache, const Transform& viewMatrix = Transform())
+    {
+        QImage view(VIEW_SIZE, VIEW_SIZE, QImage::Format_ARGB32_Premultiplied);
+        QPainter painter(&view);
+
+        const RectF viewRect(0.0, 0.0, VIEW_SIZE, VIEW_SIZE);
+        std::vector<RectF> renderedRects;
+
+        bool painted = cache.paint(&painter, viewMatrix, 1.0, false, viewRect, viewRect,
+                                   [&renderedRects](Painter*, const RectF& logicRect) {
+            renderedRects.push_back(logicRect);
+        });
+
+        EXPECT_TRUE(painted);
+
+        return renderedRects;
+    }
+};
+
+TEST_F(NotationTileCacheTests, ReuseTiles)
+{
+    NotationTileCache cache;
+
+    //! [GIVEN] The view has been painted once
+    EXPECT_EQ(paint(cache).size(), 4);
+    EXPECT_EQ(cache.tileCount(), 4);
+
+    //! [WHEN] It is painted again without changes
+    std::vector<RectF> renderedRects = paint(cache);
+
+    //! [THEN] All the tiles are reused
+    EXPECT_TRUE(renderedRects.empty());
+}
+
+TEST_F(NotationTileCacheTests, InvalidateIntersectingTiles)
+{
+    NotationTileCache cache;
+    paint(cache);
+
+    //! [WHEN] A small area inside the top left tile is invalidated
+    cache.invalidate(RectF(10.0, 10.0, 20.0, 20.0));
+
+    //! [THEN] Only that tile is rendered again
+    std::vector<RectF> renderedRects = paint(cache);
+    ASSERT_EQ(renderedRects.size(), 1);
+    EXPECT_EQ(renderedRects.front(), RectF(0.0, 0.0, 512.0, 512.0));
+
+    //! [WHEN] An area on the border of the two top tiles is invalidated
+    cache.invalidate(RectF(500.0, 10.0, 20.0, 20.0));
+
+    //! [THEN] Both of them are rendered again
+    renderedRects = paint(cache);
+    ASSERT_EQ(renderedRects.size(), 2);
+    EXPECT_EQ(renderedRects.at(0), RectF(0.0, 0.0, 512.0, 512.0));
+    EXPECT_EQ(renderedRects.at(1), RectF(512.0, 0.0, 512.0, 512.0));
+
+    //! [WHEN] An invalid rect is invalidated
+    cache.invalidate(RectF());
+
+    //! [THEN] Nothing is rendered again
+    EXPECT_TRUE(paint(cache).empty());
+}
+
+TEST_F(NotationTileCacheTests, InvalidateScaledAndScrolledView)
+{
+    NotationTileCache cache;
+
+    //! [GIVEN] The view is zoomed in twice and scrolled by 100 pixels
+    Transform viewMatrix;
+    viewMatrix.translate(-100.0, 0.0);
+    viewMatrix.scale(2.0, 2.0);
+    paint(cache, viewMatrix);
+
+    //! [WHEN] A logical area is invalidated that is painted at 300..340 pixels of the view
+    cache.invalidate(RectF(200.0, 10.0, 20.0, 20.0));
+
+    //! [THEN] Only the tile under it is rendered again
+    std::vector<RectF> renderedRects = paint(cache, viewMatrix);
+    ASSERT_EQ(renderedRects.size(), 1);
+    EXPECT_TRUE(renderedRects.front().intersects(RectF(200.0, 10.0, 20.0, 20.0)));
+}
+
+TEST_F(NotationTileCacheTests, ChangeScale)
+{
+    NotationTileCache cache;
+    paint(cache);
+
+    //! [WHEN] The view is zoomed
+    Transform viewMatrix;
+    viewMatrix.scale(2.0, 2.0);
+    std::vector<RectF> renderedRects = paint(cache, viewMatrix);
+
+    //! [THEN] All the visible tiles are rendered again at the new scale
+    ASSERT_EQ(renderedRects.size(), 4);
+    EXPECT_EQ(renderedRects.front(), RectF(0.0, 0.0, 256.0, 256.0));
+}
+
+TEST_F(NotationTileCacheTests, Clear)
+{
+    NotationTileCache cache;
+    paint(cache);
+
+    //! [WHEN] The cache is cleared
+    cache.clear();
+
+    //! [THEN] All the tiles are rendered again
+    EXPECT_EQ(cache.tileCount(), 0);
+    EXPECT_EQ(paint(cache).size(), 4);
+}
@@ -246,7 +246,16 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
             interaction->hideShadowNote();
         }
         m_shadowNoteRect = RectF();
-        scheduleRedraw();
+
+        //! NOTE The changed area has already been reported by scoreRefreshRequested,
+        //! unless the notation was changed without updating the score
+        if (!m_scoreRefreshedSinceNotationChanged) {
+            m_tileCache.clear();
+        }
+        m_scoreRefreshedSinceNotationChanged = false;
+        invalidateSelectionTiles();
+
+        scheduleNotationRedraw();
     });
 
     onNoteInputStateChanged();
@@ -266,10 +275,22 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
         }
     });
 
+    interaction->scoreRefreshRequested().onReceive(this, [this](const RectF& rect) {
+        if (rect.isValid()) {
+            m_tileCache.invalidate(rect);
+        } else {
+            m_tileCache.clear();
+        }
+        m_scoreRefreshedSinceNotationChanged = true;
+    });
+
     interaction->selectionChanged().onNotify(this, [this]() {
-        scheduleRedraw();
+        invalidateSelectionTiles();
+        scheduleNotationRedraw();
     });
 
+    m_selectionRect = selectionRect();
+
     interaction->showItemRequested().onReceive(this, [this](const INotationInteraction::ShowItemRequest& request) {
         onShowItemRequested(request);
     });
@@ -338,6 +359,7 @@ void AbstractNotationPaintView::onUnloadNotation(INotationPtr)
     m_notation->notationChanged().resetOnNotify(this);
     INotationInteractionPtr interaction = m_notation->interaction();
     interaction->noteInput()->stateChanged().resetOnNotify(this);
+    interaction->scoreRefreshRequested().resetOnReceive(this);
     interaction->selectionChanged().resetOnNotify(this);
 
     if (isMainView()) {
@@ -379,7 +401,7 @@ void AbstractNotationPaintView::onMatrixChanged(const Transform& oldMatrix, cons
         m_shadowNoteRect = newMatrix.map(logicRect);
     }
 
-    scheduleRedraw();
+    scheduleViewRedraw();
 
     emit horizontalScrollChanged();
     emit verticalScrollChanged();
@@ -406,7 +428,7 @@ void AbstractNotationPaintView::onViewSizeChanged()
 
     ensureViewportInsideScrollableArea();
 
-    scheduleRedraw();
+    scheduleViewRedraw();
 
     emit horizontalScrollChanged();
     emit verticalScrollChanged();
@@ -427,7 +449,7 @@ void AbstractNotationPaintView::updateLoopMarkers()
     m_loopInMarker->setVisible(loop.enabled);
     m_loopOutMarker->setVisible(loop.enabled);
 
-    scheduleRedraw();
+    scheduleViewRedraw();
 }
 
 NotationViewInputController* AbstractNotationPaintView::inputController() const
@@ -484,7 +506,7 @@ void AbstractNotationPaintView::onNoteInputStateChanged()
     if (INotationInteractionPtr interaction = notationInteraction()) {
         interaction->hideShadowNote();
         m_shadowNoteRect = RectF();
-        scheduleRedraw();
+        scheduleViewRedraw();
     }
 }
 
@@ -524,7 +546,7 @@ void AbstractNotationPaintView::showShadowNote(const PointF& pos)
     bool visible = notationInteraction()->showShadowNote(pos);
 
     if (m_shadowNoteRect.isValid()) {
-        scheduleRedraw(m_shadowNoteRect);
+        scheduleViewRedraw(m_shadowNoteRect);
 
         if (!visible) {
             m_shadowNoteRect = RectF();
@@ -536,7 +558,7 @@ void AbstractNotationPaintView::showShadowNote(const PointF& pos)
 
     if (shadowNoteRect.isValid()) {
         compensateFloatPart(shadowNoteRect);
-        scheduleRedraw(shadowNoteRect);
+        scheduleViewRedraw(shadowNoteRect);
     }
 
     m_shadowNoteRect = shadowNoteRect;
@@ -630,8 +652,7 @@ void AbstractNotationPaintView::paint(QPainter* qp)
 
     painter->setWorldTransform(m_matrix * guiScalingCompensation);
 
-    bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    paintNotation(rect, qp, painter);
 
     const ui::UiContext uiCtx = uiContextResolver()->currentUiContext();
     const bool isOnNotationPage = uiCtx == ui::UiCtxProjectOpened || uiCtx == ui::UiCtxProjectFocused;
@@ -703,6 +724,36 @@ void AbstractNotationPaintView::paintBackground(const RectF& rect, muse::draw::P
     }
 }
 
+void AbstractNotationPaintView::paintNotation(const RectF& rect, QPainter* qp, muse::draw::Painter* painter)
+{
+    TRACEFUNC;
+
+    INotationPaintingPtr painting = notation()->painting();
+    const bool isPrinting = publishMode() || m_inputController->readonly();
+
+    //! NOTE Right after the notation has changed, it is painted directly, because it is likely to change again
+    //! (e.g. while dragging an element) and rendering whole tiles would be wasted.
+    //! The tiles pay off when only the view changes, e.g. when scrolling or zooming
+    bool isPaintedWithTiles = false;
+    if (!m_notationChangedSinceLastPaint) {
+        RectF visibleRect(0.0, 0.0, width(), height());
+        isPaintedWithTiles = m_tileCache.paint(qp, painter->worldTransform(), qp->device()->devicePixelRatio(), isPrinting,
+                                               rect, visibleRect, [painting, isPrinting](Painter* tilePainter, const RectF& logicRect) {
+            painting->paintViewScore(tilePainter, logicRect, isPrinting);
+        });
+    }
+
+    m_notationChangedSinceLastPaint = false;
+
+    if (!isPaintedWithTiles) {
+        painting->paintViewScore(painter, toLogical(rect), isPrinting);
+    }
+
+    if (!isPrinting) {
+        painting->paintViewInteraction(painter);
+    }
+}
+
 PointF AbstractNotationPaintView::canvasCenter() const
 {
     TRACEFUNC;
@@ -1035,6 +1086,54 @@ bool AbstractNotationPaintView::doMoveCanvas(qreal dx, qreal dy)
 }
 
 void AbstractNotationPaintView::scheduleRedraw(const muse::RectF& rect)
+{
+    //! NOTE Everything painted may have changed (e.g. the colors), so all the rasterized tiles are out of date
+    m_tileCache.clear();
+    scheduleNotationRedraw(rect);
+}
+
+//! NOTE Redraws the view after the notation has changed,
+//! the tiles of the changed area are expected to be invalidated already
+void AbstractNotationPaintView::scheduleNotationRedraw(const muse::RectF& rect)
+{
+    m_notationChangedSinceLastPaint = true;
+    scheduleViewRedraw(rect);
+}
+
+//! NOTE Selected elements are painted in the selection color,
+//! so the tiles under the old and the new selection are out of date
+void AbstractNotationPaintView::invalidateSelectionTiles()
+{
+    RectF newSelectionRect = selectionRect();
+    m_tileCache.invalidate(m_selectionRect);
+    m_tileCache.invalidate(newSelectionRect);
+    m_selectionRect = newSelectionRect;
+}
+
+RectF AbstractNotationPaintView::selectionRect() const
+{
+    INotationSelectionPtr selection = notationSelection();
+    if (!selection) {
+        return RectF();
+    }
+
+    RectF rect;
+    for (const EngravingItem* item : selection->elements()) {
+        if (item->isSpanner()) {
+            for (const mu::engraving::SpannerSegment* segment : mu::engraving::toSpanner(item)->spannerSegments()) {
+                rect.unite(segment->canvasBoundingRect());
+            }
+        } else {
+            rect.unite(item->canvasBoundingRect());
+        }
+    }
+
+    return rect;
+}
+
+//! NOTE Redraws the view when only the view itself has changed (scrolled, zoomed, resized)
+//! or something painted over the notation (cursors, markers, shadow note), so the tiles are still valid
+void AbstractNotationPaintView::scheduleViewRedraw(const muse::RectF& rect)
 {
     QRect qrect = correctDrawRect(rect).toQRect();
     update(qrect);
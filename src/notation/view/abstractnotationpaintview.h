@@ -46,6 +46,7 @@
 #include "playbackcursor.h"
 #include "loopmarker.h"
 #include "continuouspanel.h"
+#include "notationtilecache.h"
 #include "abstractelementpopupmodel.h"
 
 namespace mu::notation {
@@ -213,6 +214,10 @@ private:
     bool doMoveCanvas(qreal dx, qreal dy);
 
     void scheduleRedraw(const muse::RectF& rect = muse::RectF());
+    void scheduleNotationRedraw(const muse::RectF& rect = muse::RectF());
+    void scheduleViewRedraw(const muse::RectF& rect = muse::RectF());
+    void invalidateSelectionTiles();
+    muse::RectF selectionRect() const;
     muse::RectF correctDrawRect(const muse::RectF& rect) const;
 
     // Input
@@ -259,6 +264,7 @@ private:
     muse::PointF alignToCurrentPageBorder(const muse::RectF& showRect, const muse::PointF& pos) const;
 
     void paintBackground(const muse::RectF& rect, muse::draw::Painter* painter);
+    void paintNotation(const muse::RectF& rect, QPainter* qp, muse::draw::Painter* painter);
 
     muse::PointF canvasCenter() const;
     std::pair<qreal, qreal> constraintCanvas(qreal dx, qreal dy) const;
@@ -275,6 +281,11 @@ private:
     std::unique_ptr<LoopMarker> m_loopOutMarker;
     std::unique_ptr<ContinuousPanel> m_continuousPanel;
 
+    NotationTileCache m_tileCache;
+    bool m_notationChangedSinceLastPaint = true;
+    bool m_scoreRefreshedSinceNotationChanged = false;
+    muse::RectF m_selectionRect;
+
     qreal m_previousVerticalScrollPosition = 0;
     qreal m_previousHorizontalScrollPosition = 0;
 
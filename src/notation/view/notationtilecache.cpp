@@ -0,0 +1,206 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "notationtilecache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "realfn.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::draw;
+using namespace mu::notation;
+
+static constexpr int TILE_SIZE = 512; // device pixels
+
+bool NotationTileCache::Grid::operator==(const Grid& other) const
+{
+    return RealIsEqual(scale, other.scale)
+           && RealIsEqual(offsetX, other.offsetX)
+           && RealIsEqual(offsetY, other.offsetY)
+           && RealIsEqual(devicePixelRatio, other.devicePixelRatio)
+           && isPrinting == other.isPrinting;
+}
+
+bool NotationTileCache::paint(QPainter* painter, const Transform& viewMatrix, double devicePixelRatio, bool isPrinting,
+                              const RectF& dirtyRect, const RectF& visibleRect, const RenderFunc& render)
+{
+    TRACEFUNC;
+
+    //! NOTE Tiles can only be blitted as they are if the view is just scaled and translated
+    if (!RealIsNull(viewMatrix.m12()) || !RealIsNull(viewMatrix.m21()) || !RealIsEqual(viewMatrix.m11(), viewMatrix.m22())
+        || viewMatrix.m11() <= 0.0 || devicePixelRatio <= 0.0) {
+        return false;
+    }
+
+    const double offsetX = viewMatrix.dx() * devicePixelRatio;
+    const double offsetY = viewMatrix.dy() * devicePixelRatio;
+    const double pixelOffsetX = std::floor(offsetX);
+    const double pixelOffsetY = std::floor(offsetY);
+
+    Grid grid;
+    grid.scale = viewMatrix.m11() * devicePixelRatio;
+    grid.offsetX = offsetX - pixelOffsetX;
+    grid.offsetY = offsetY - pixelOffsetY;
+    grid.devicePixelRatio = devicePixelRatio;
+    grid.isPrinting = isPrinting;
+
+    if (grid != m_grid) {
+        clear();
+        m_grid = grid;
+    }
+
+    const TileRange dirtyRange = tileRange(dirtyRect, pixelOffsetX, pixelOffsetY);
+
+    painter->save();
+    painter->resetTransform();
+
+    for (int row = dirtyRange.firstRow; row <= dirtyRange.lastRow; ++row) {
+        for (int column = dirtyRange.firstColumn; column <= dirtyRange.lastColumn; ++column) {
+            const TileIndex index { column, row };
+
+            auto it = m_tiles.find(index);
+            if (it == m_tiles.end()) {
+                it = m_tiles.emplace(index, renderTile(index, render)).first;
+            }
+
+            const QPointF tilePos((column * TILE_SIZE + pixelOffsetX) / devicePixelRatio,
+                                  (row * TILE_SIZE + pixelOffsetY) / devicePixelRatio);
+
+            painter->drawImage(tilePos, it->second);
+        }
+    }
+
+    painter->restore();
+
+    //! NOTE Keep a margin of half the visible area around it, so that scrolling back and forth stays cheap
+    TileRange keptRange = tileRange(visibleRect, pixelOffsetX, pixelOffsetY);
+    const int columnMargin = std::max(1, (keptRange.lastColumn - keptRange.firstColumn + 1) / 2);
+    const int rowMargin = std::max(1, (keptRange.lastRow - keptRange.firstRow + 1) / 2);
+    keptRange.firstColumn -= columnMargin;
+    keptRange.lastColumn += columnMargin;
+    keptRange.firstRow -= rowMargin;
+    keptRange.lastRow += rowMargin;
+
+    dropTilesOutside(keptRange);
+
+    return true;
+}
+
+void NotationTileCache::invalidate(const RectF& logicRect)
+{
+    if (m_tiles.empty() || !logicRect.isValid()) {
+        return;
+    }
+
+    //! NOTE A tile covers the logical rect starting at (index * TILE_SIZE - offset) / scale,
+    //! independently of the whole pixel part of the view offset.
+    //! One more pixel on each side catches antialiasing
+    const double left = logicRect.left() * m_grid.scale + m_grid.offsetX - 1.0;
+    const double right = logicRect.right() * m_grid.scale + m_grid.offsetX + 1.0;
+    const double top = logicRect.top() * m_grid.scale + m_grid.offsetY - 1.0;
+    const double bottom = logicRect.bottom() * m_grid.scale + m_grid.offsetY + 1.0;
+
+    const int firstColumn = static_cast<int>(std::floor(left / TILE_SIZE));
+    const int lastColumn = static_cast<int>(std::ceil(right / TILE_SIZE)) - 1;
+    const int firstRow = static_cast<int>(std::floor(top / TILE_SIZE));
+    const int lastRow = static_cast<int>(std::ceil(bottom / TILE_SIZE)) - 1;
+
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        const TileIndex& index = it->first;
+
+        if (index.first >= firstColumn && index.first <= lastColumn
+            && index.second >= firstRow && index.second <= lastRow) {
+            it = m_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void NotationTileCache::clear()
+{
+    m_tiles.clear();
+}
+
+size_t NotationTileCache::tileCount() const
+{
+    return m_tiles.size();
+}
+
+NotationTileCache::TileRange NotationTileCache::tileRange(const RectF& viewRect, double pixelOffsetX, double pixelOffsetY) const
+{
+    TileRange range;
+
+    if (!viewRect.isValid()) {
+        return range;
+    }
+
+    const double dpr = m_grid.devicePixelRatio;
+
+    range.firstColumn = static_cast<int>(std::floor((viewRect.left() * dpr - pixelOffsetX) / TILE_SIZE));
+    range.lastColumn = static_cast<int>(std::ceil((viewRect.right() * dpr - pixelOffsetX) / TILE_SIZE)) - 1;
+    range.firstRow = static_cast<int>(std::floor((viewRect.top() * dpr - pixelOffsetY) / TILE_SIZE));
+    range.lastRow = static_cast<int>(std::ceil((viewRect.bottom() * dpr - pixelOffsetY) / TILE_SIZE)) - 1;
+
+    return range;
+}
+
+QImage NotationTileCache::renderTile(const TileIndex& index, const RenderFunc& render) const
+{
+    TRACEFUNC;
+
+    QImage image(TILE_SIZE, TILE_SIZE, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    //! NOTE Maps logical coordinates to the pixels of this tile
+    Transform tileMatrix;
+    tileMatrix.translate(m_grid.offsetX - index.first * TILE_SIZE, m_grid.offsetY - index.second * TILE_SIZE);
+    tileMatrix.scale(m_grid.scale, m_grid.scale);
+
+    {
+        Painter painter(&image, "notation_tile");
+        painter.setWorldTransform(tileMatrix);
+        render(&painter, tileMatrix.inverted().map(RectF(0.0, 0.0, TILE_SIZE, TILE_SIZE)));
+    }
+
+    image.setDevicePixelRatio(m_grid.devicePixelRatio);
+
+    return image;
+}
+
+void NotationTileCache::dropTilesOutside(const TileRange& range)
+{
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        const TileIndex& index = it->first;
+
+        if (index.first < range.firstColumn || index.first > range.lastColumn
+            || index.second < range.firstRow || index.second > range.lastRow) {
+            it = m_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
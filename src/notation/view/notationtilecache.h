@@ -0,0 +1,86 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <map>
+
+#include <QImage>
+#include <QPainter>
+
+#include "draw/painter.h"
+#include "draw/types/geometry.h"
+#include "draw/types/transform.h"
+
+namespace mu::notation {
+//! NOTE Keeps the rasterized score of a notation view in tiles of a fixed size in device pixels,
+//! so that scrolling only renders the tiles that come into view and the rest is just blitted.
+//! The tiles belong to a grid defined by the view scale and the subpixel part of the view offset,
+//! so changing the zoom starts a new grid, while panning by whole pixels keeps it.
+class NotationTileCache
+{
+public:
+    using RenderFunc = std::function<void (muse::draw::Painter* painter, const muse::RectF& logicRect)>;
+
+    //! NOTE Paints `dirtyRect` of the view with the cached tiles, rendering the missing ones with `render`.
+    //! `viewMatrix` maps logical coordinates to view coordinates, `visibleRect` is the whole view
+    //! and is used to drop the tiles that went far out of sight.
+    //! Returns false if the view can't be painted with tiles (e.g. it is rotated)
+    bool paint(QPainter* painter, const muse::draw::Transform& viewMatrix, double devicePixelRatio, bool isPrinting,
+               const muse::RectF& dirtyRect, const muse::RectF& visibleRect, const RenderFunc& render);
+
+    //! NOTE Drops the tiles that intersect `logicRect`, so that they are rendered again when painted
+    void invalidate(const muse::RectF& logicRect);
+    void clear();
+
+    size_t tileCount() const;
+
+private:
+    struct Grid {
+        double scale = 0.0;
+        double offsetX = 0.0; // subpixel parts of the view offset, in device pixels
+        double offsetY = 0.0;
+        double devicePixelRatio = 0.0;
+        bool isPrinting = false;
+
+        bool operator==(const Grid& other) const;
+        bool operator!=(const Grid& other) const { return !(*this == other); }
+    };
+
+    using TileIndex = std::pair<int /*column*/, int /*row*/>;
+
+    struct TileRange {
+        int firstColumn = 0;
+        int lastColumn = -1;
+        int firstRow = 0;
+        int lastRow = -1;
+    };
+
+    TileRange tileRange(const muse::RectF& viewRect, double pixelOffsetX, double pixelOffsetY) const;
+    QImage renderTile(const TileIndex& index, const RenderFunc& render) const;
+    void dropTilesOutside(const TileRange& range);
+
+    Grid m_grid;
+    std::map<TileIndex, QImage> m_tiles;
+};
+}